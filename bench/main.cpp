@@ -0,0 +1,392 @@
+// Micro-benchmarks des chemins chauds du moteur (sans fenêtre; seul Tilemap::setTile/shader
+// demande un contexte OpenGL, et il est ignoré si aucun n'est disponible).
+//
+// Usage: BoooBee_bench [--output fichier.json] [--filter sous-chaîne] [--iterations N]
+//
+// Chaque benchmark est exécuté quelques fois à vide (chauffe), puis un nombre
+// fixe d'itérations est chronométré. Les résultats (ns par opération) sont
+// écrits en JSON pour pouvoir comparer deux builds automatiquement.
+
+#include <SFML/Graphics.hpp>
+#include "AmbientParticles.hpp"
+#include "Level.hpp"
+#include "LevelFile.hpp"
+#include "Player.hpp"
+#include "ParticleSystem.hpp"
+#include "Random.hpp"
+#include "TileCollision.hpp"
+#include "Tilemap.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct Benchmark {
+    std::string name;
+    int iterations;                  // Itérations chronométrées (multipliées par --iterations)
+    std::function<void()> setup;     // Appelé avant chaque itération, hors chronométrage (optionnel)
+    std::function<void()> body;      // L'opération mesurée
+};
+
+struct Result {
+    std::string name;
+    int iterations = 0;
+    double meanNs = 0.0;
+    double medianNs = 0.0;
+    double minNs = 0.0;
+    double maxNs = 0.0;
+};
+
+constexpr int WARMUP_ITERATIONS = 3;
+
+Result runBenchmark(const Benchmark& benchmark, int iterations) {
+    using Clock = std::chrono::steady_clock;
+
+    for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+        if (benchmark.setup) benchmark.setup();
+        benchmark.body();
+    }
+
+    std::vector<double> samples;
+    samples.reserve(iterations);
+    for (int i = 0; i < iterations; ++i) {
+        if (benchmark.setup) benchmark.setup();
+        auto start = Clock::now();
+        benchmark.body();
+        auto end = Clock::now();
+        samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+    }
+
+    Result result;
+    result.name = benchmark.name;
+    result.iterations = iterations;
+    if (samples.empty()) return result;
+
+    std::sort(samples.begin(), samples.end());
+    double sum = 0.0;
+    for (double sample : samples) sum += sample;
+    result.meanNs = sum / samples.size();
+    result.medianNs = samples[samples.size() / 2];
+    result.minNs = samples.front();
+    result.maxNs = samples.back();
+    return result;
+}
+
+// Niveau synthétique au format des niveaux livrés: sol continu, plateformes en escalier
+// et murs réguliers, pour mesurer le passage à l'échelle sur de grandes cartes
+fs::path writeSyntheticLevel(int width, int height) {
+    fs::path path = fs::temp_directory_path() /
+                    ("booobee_bench_" + std::to_string(width) + "x" + std::to_string(height) + ".json");
+
+    std::ofstream file(path);
+    file << "{\n  \"width\": " << width << ",\n  \"height\": " << height << ",\n  \"tiles\": [\n";
+    for (int y = 0; y < height; ++y) {
+        file << "    [";
+        for (int x = 0; x < width; ++x) {
+            int tile = -1;
+            if (y == height - 3) {
+                tile = 1 + (x % 4);                        // Sol avec herbe
+            } else if (y > height - 3) {
+                tile = 15;                                 // Terre pleine
+            } else if (x % 12 >= 4 && x % 12 < 8 && y == height - 6 - (x / 12) % 4 * 2) {
+                tile = 2;                                  // Plateformes
+            } else if (x % 48 == 47 && y >= height - 5) {
+                tile = 14;                                 // Murs
+            }
+            file << tile << (x + 1 < width ? ", " : "");
+        }
+        file << "]" << (y + 1 < height ? "," : "") << "\n";
+    }
+    file << "  ],\n  \"enemies\": [\n  ],\n";
+    file << "  \"exitPortal\": {\"x\": " << width - 3 << ", \"y\": " << height - 4 << "},\n";
+    file << "  \"entrancePortal\": {\"x\": 2, \"y\": " << height - 4 << "}\n}\n";
+    return path;
+}
+
+// Vérifie les effets d'un setTile (bits de collision, chunks non vides) avant de le mesurer:
+// une tile posée dans un chunk vide du niveau synthétique, puis effacée
+bool checkTileEdits(Tilemap& tilemap, const std::string& mode) {
+    const bool chunks = tilemap.getRenderMode() == Tilemap::RenderMode::Chunks;
+    const int platformY = tilemap.getHeight() - 6;           // Plateforme (tile 2) en x = 4..7, voir writeSyntheticLevel
+    const std::uint8_t platformFlags = tilemap.getCellFlags(4, platformY);
+    const int chunksBefore = tilemap.getNonEmptyChunkCount();
+    bool ok = tilemap.getTileId(4, platformY) == 2 && (platformFlags & Tilemap::CELL_GROUND) != 0;
+
+    tilemap.setTile(8, 8, 2);  // Chunk (0, 0): uniquement de l'air
+    ok = ok && tilemap.getTileId(8, 8) == 2 && tilemap.getCellFlags(8, 8) == platformFlags;
+    ok = ok && tilemap.getNonEmptyChunkCount() == (chunks ? chunksBefore + 1 : 0);
+    if (chunks) {
+        // Le compte incrémental doit égaler celui d'une reconstruction complète
+        tilemap.updateVertices();
+        ok = ok && tilemap.getNonEmptyChunkCount() == chunksBefore + 1;
+    }
+
+    tilemap.setTile(8, 8, -1);
+    ok = ok && tilemap.getTileId(8, 8) == -1 && tilemap.getCellFlags(8, 8) == 0 && !tilemap.isSolid(8, 8);
+    ok = ok && tilemap.getNonEmptyChunkCount() == (chunks ? chunksBefore : 0);
+
+    if (!ok) {
+        std::cerr << "Tilemap::setTile/" << mode << ": bits de collision ou chunks incorrects après modification" << std::endl;
+    }
+    return ok;
+}
+
+// Trait d'éditeur: une plateforme de 16 tiles posée dans un chunk vide, puis effacée
+void paintAndErase(Tilemap& tilemap) {
+    for (int x = 0; x < 16; ++x) tilemap.setTile(x, 8, 2);
+    for (int x = 0; x < 16; ++x) tilemap.setTile(x, 8, -1);
+}
+
+std::string levelPath(int levelNumber) {
+    return levelNumber == 0 ? "levels/prologue.json" : "levels/level_" + std::to_string(levelNumber) + ".json";
+}
+
+void writeJson(std::ostream& out, const std::vector<Result>& results) {
+    out << "{\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "    {\"name\": \"" << r.name << "\", \"iterations\": " << r.iterations
+            << ", \"mean_ns\": " << static_cast<long long>(r.meanNs)
+            << ", \"median_ns\": " << static_cast<long long>(r.medianNs)
+            << ", \"min_ns\": " << static_cast<long long>(r.minNs)
+            << ", \"max_ns\": " << static_cast<long long>(r.maxNs) << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string outputPath;
+    std::string filter;
+    int iterationScale = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--output" && hasValue) {
+            outputPath = argv[++i];
+        } else if (arg == "--filter" && hasValue) {
+            filter = argv[++i];
+        } else if (arg == "--iterations" && hasValue) {
+            iterationScale = std::max(1, std::stoi(argv[++i]));
+        }
+    }
+
+    // Les niveaux et assets sont lus relativement à la racine du projet
+#ifdef BOOOBEE_DATA_DIR
+    // --output est relatif au répertoire d'appel: le résoudre avant de changer de répertoire
+    if (!outputPath.empty()) {
+        outputPath = fs::absolute(outputPath).string();
+    }
+    std::error_code error;
+    fs::current_path(BOOOBEE_DATA_DIR, error);
+    if (error) {
+        std::cerr << "Impossible d'accéder au répertoire de données " << BOOOBEE_DATA_DIR << ": " << error.message() << std::endl;
+        return 1;
+    }
+#endif
+
+    // Les logs de debug du moteur faussent les mesures: les couper pendant les benchmarks
+    std::ostringstream discarded;
+    std::streambuf* coutBuffer = std::cout.rdbuf();
+    std::cout.rdbuf(discarded.rdbuf());
+
+    // Graine fixe: mêmes niveaux, ennemis et particules d'une exécution à l'autre
+    Random::getInstance().setSeed(42);
+
+    const fs::path largeLevel = writeSyntheticLevel(256, 64);
+    const fs::path hugeLevel = writeSyntheticLevel(1024, 128);
+
+    // Niveau de référence partagé par les benchmarks de gameplay
+    Level level(true);
+    level.getTilemap().loadFromFile("assets/tiles/Mossy Tileset/Mossy - TileSet.png");
+    level.loadFromFile(largeLevel.string());
+
+    Player player(CharacterType::Wizard, true);
+
+    std::vector<Benchmark> benchmarks;
+
+    // Chargement des niveaux livrés et synthétiques
+    for (int levelNumber : {0, 1, 2, 3, 4, 5, 8}) {
+        std::string path = levelPath(levelNumber);
+        if (!fs::exists(path)) continue;
+        benchmarks.push_back({"Level::loadFromFile/" + fs::path(path).stem().string(), 50, nullptr, [path]() {
+            Level loaded(true);
+            loaded.loadFromFile(path);
+        }});
+    }
+    benchmarks.push_back({"Level::loadFromFile/synthetic_256x64", 20, nullptr, [largeLevel]() {
+        Level loaded(true);
+        loaded.loadFromFile(largeLevel.string());
+    }});
+    benchmarks.push_back({"Level::loadFromFile/synthetic_1024x128", 5, nullptr, [hugeLevel]() {
+        Level loaded(true);
+        loaded.loadFromFile(hugeLevel.string());
+    }});
+
+    // Même carte au format binaire (projeté en mémoire, sans analyse par tile). Nom distinct:
+    // un .bblv voisin du JSON serait utilisé à sa place par le benchmark précédent
+    const fs::path hugeBinaryLevel = fs::path(hugeLevel).replace_extension().string() + "_binary" + LevelFile::BINARY_EXTENSION;
+    LevelData hugeData;
+    if (LevelFile::loadJson(hugeLevel.string(), hugeData) && LevelFile::saveBinary(hugeBinaryLevel.string(), hugeData)) {
+        benchmarks.push_back({"Level::loadFromFile/synthetic_1024x128_binary", 20, nullptr, [hugeBinaryLevel]() {
+            Level loaded(true);
+            loaded.loadFromFile(hugeBinaryLevel.string());
+        }});
+    }
+
+    // Collisions: un pas à 60 Hz (120, 300 px/s) qui atterrit au sol, traverse l'air ou bute contre un mur
+    const int groundY = (level.getHeight() - 3) * level.getTileSize();
+    const sf::Vector2f velocity(120.0f, 300.0f);
+    const sf::Vector2f stepDisplacement = velocity / 60.0f;
+    const float standingY = groundY - 102.0f + 25.0f;  // Joueur debout: pieds (25 px au-dessus du bas) sur le sol
+    const std::vector<std::pair<std::string, sf::Vector2f>> collisionCases = {
+        {"ground", sf::Vector2f(640.0f, standingY - 3.0f)},           // 3 px au-dessus du sol
+        {"air", sf::Vector2f(640.0f, 128.0f)},
+        {"wall", sf::Vector2f(47 * 64.0f - 51.0f - 1.0f, standingY)},  // Centre à 1 px du mur de la colonne 47
+    };
+    for (const auto& collisionCase : collisionCases) {
+        const sf::Vector2f from = collisionCase.second;
+        benchmarks.push_back({"Level::handlePlayerCollision/" + collisionCase.first, 20000,
+            [&player, from, stepDisplacement, velocity]() {
+                player.setStep(from, from + stepDisplacement);
+                player.setVelocity(velocity);
+            },
+            [&level, &player]() { level.handlePlayerCollision(player); }});
+    }
+
+    // Balayage d'une charge héroïque sur un pas très long (800 px/s pendant 500 ms), arrêtée par le mur
+    const CollisionBody playerBody{sf::Vector2f(102.0f, 102.0f), 25.0f};
+    benchmarks.push_back({"TileCollision::move/charge", 20000, nullptr,
+        [&level, playerBody, groundY]() {
+            TileCollision::move(level.getTilemap(), playerBody, sf::Vector2f(40 * 64.0f, groundY - 77.0f), sf::Vector2f(400.0f, 0.0f));
+        }});
+
+    // Reconstruction complète de la géométrie des chunks (copie CPU, sans GPU)
+    benchmarks.push_back({"Tilemap::updateVertices/synthetic_256x64", 50, nullptr, [&level]() {
+        level.getTilemap().updateVertices();
+    }});
+
+    // Modification de tiles (éditeur): un chunk reconstruit par tile en mode Chunks (copie CPU),
+    // un texel de la texture d'indices en mode Shader (seulement si un contexte OpenGL est disponible)
+    Level editedLevel(true);
+    editedLevel.loadFromFile(largeLevel.string());
+    Tilemap& editedChunks = editedLevel.getTilemap();
+    editedChunks.updateVertices();
+    bool tileEditsValid = checkTileEdits(editedChunks, "chunks");
+    if (tileEditsValid) {
+        benchmarks.push_back({"Tilemap::setTile/chunks", 2000, nullptr, [&editedChunks]() {
+            paintAndErase(editedChunks);
+        }});
+    }
+
+    Tilemap editedShader(64);
+    LevelData largeData;
+    bool shaderReady = sf::Shader::isAvailable()
+        && LevelFile::loadJson(largeLevel.string(), largeData)
+        && editedShader.loadFromFile("assets/tiles/Mossy Tileset/Mossy - TileSet.png");
+    if (shaderReady) {
+        editedShader.loadFromData(largeData.tiles, largeData.width, largeData.height, 14);
+        shaderReady = editedShader.setRenderMode(Tilemap::RenderMode::Shader);
+    }
+    if (shaderReady) {
+        if (checkTileEdits(editedShader, "shader")) {
+            benchmarks.push_back({"Tilemap::setTile/shader", 2000, nullptr, [&editedShader]() {
+                paintAndErase(editedShader);
+            }});
+        } else {
+            tileEditsValid = false;
+        }
+    } else {
+        std::cerr << "Tilemap::setTile/shader: ignoré (shaders indisponibles)" << std::endl;
+    }
+
+    // Particules: 20 désintégrations (1000 particules), un pas de simulation à 60 Hz
+    const std::size_t particleCapacity = 20 * ParticleEffects::DISINTEGRATION_COUNT;
+    ParticleSystem particlesTemplate(ParticleEffects::disintegration(), particleCapacity);
+    for (int i = 0; i < 20; ++i) {
+        particlesTemplate.burst(sf::Vector2f(100.0f * i, 300.0f), ParticleEffects::DISINTEGRATION_COUNT, sf::Color(120, 180, 255));
+    }
+    ParticleSystem particles(ParticleEffects::disintegration(), particleCapacity);
+    benchmarks.push_back({"ParticleSystem::update/1000", 2000,
+        [&particles, &particlesTemplate]() { particles = particlesTemplate; },
+        [&particles]() { particles.update(sf::seconds(1.0f / 60.0f)); }});
+
+    // Émetteur continu en régime établi (~900 particules vivantes): aucune allocation par pas
+    ParticleSystem emitted(ParticleEffects::disintegration(), 2048);
+    emitted.addEmitter(sf::Vector2f(640.0f, 300.0f), 600.0f);
+    for (int i = 0; i < 180; ++i) {
+        emitted.update(sf::seconds(1.0f / 60.0f));
+    }
+    benchmarks.push_back({"ParticleSystem::update/emitter_600", 2000, nullptr,
+        [&emitted]() { emitted.update(sf::seconds(1.0f / 60.0f)); }});
+
+    // Décor ambiant du niveau de référence
+    benchmarks.push_back({"Level::updateAmbientEffects/synthetic_256x64", 5000, nullptr, [&level]() {
+        level.updateAmbientEffects(sf::seconds(1.0f / 60.0f));
+    }});
+
+    // Noyau des particules ambiantes à grande échelle (la dérive finit par déclencher les réapparitions)
+    AmbientParticles ambientCrowd;
+    Pcg32 ambientRng(42, 0);
+    ambientCrowd.generate(20000, 1024 * 64.0f, 128 * 64.0f, ambientRng);
+    benchmarks.push_back({"AmbientParticles::update/20000", 2000, nullptr, [&ambientCrowd]() {
+        ambientCrowd.update(1.0f / 60.0f, 1024 * 64.0f, 128 * 64.0f);
+    }});
+
+    // Génération procédurale des ennemis (niveau 5 = règles de base)
+    benchmarks.push_back({"Level::generateEnemies/synthetic_256x64", 200, nullptr, [&level]() {
+        level.generateEnemies(5);
+    }});
+
+    // Tick complet avec une foule d'ennemis répartis sur la grande carte (joueur dans un coin)
+    Level crowdLevel(true);
+    crowdLevel.loadFromFile(hugeLevel.string());
+    for (int i = 0; i < 5000; ++i) {
+        crowdLevel.addEnemy(sf::Vector2f(64.0f * ((i * 37) % 1024) + 32.0f, 64.0f * ((i * 13) % 120) + 32.0f));
+    }
+    Player crowdPlayer(CharacterType::Wizard, true);
+    crowdPlayer.setPosition(sf::Vector2f(640.0f, 128.0f));
+    benchmarks.push_back({"Level::update/enemies_5000", 500, nullptr, [&crowdLevel, &crowdPlayer]() {
+        crowdLevel.update(sf::seconds(1.0f / 60.0f), crowdPlayer);
+    }});
+
+    std::vector<Result> results;
+    for (const Benchmark& benchmark : benchmarks) {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) continue;
+        results.push_back(runBenchmark(benchmark, benchmark.iterations * iterationScale));
+        std::cerr << benchmark.name << ": " << static_cast<long long>(results.back().medianNs) << " ns (médiane)" << std::endl;
+    }
+
+    std::cout.rdbuf(coutBuffer);
+
+    std::error_code removeError;
+    fs::remove(largeLevel, removeError);
+    fs::remove(hugeLevel, removeError);
+    fs::remove(hugeBinaryLevel, removeError);
+
+    if (!outputPath.empty()) {
+        std::ofstream output(outputPath);
+        if (!output.is_open()) {
+            std::cerr << "Impossible d'écrire " << outputPath << std::endl;
+            return 1;
+        }
+        writeJson(output, results);
+    } else {
+        writeJson(std::cout, results);
+    }
+
+    // Un setTile incorrect fait échouer l'exécution (après l'écriture des autres mesures)
+    return tileEditsValid ? 0 : 1;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Random.hpp"
+#include <cstdint>
+#include <vector>
+
+// Particules ambiantes flottantes (poussière, spore, pollen), un tableau par champ.
+// update() est un noyau sans branche ni appel de bibliothèque (sin/cos polynomiaux,
+// générateur par particule) que le compilateur vectorise: des dizaines de milliers
+// de particules coûtent moins d'une milliseconde par tick.
+struct AmbientParticles {
+    std::vector<float> baseX;      // Position de base pour l'oscillation
+    std::vector<float> baseY;
+    std::vector<float> x;          // Position finale (base + oscillation)
+    std::vector<float> y;
+    std::vector<float> size;
+    std::vector<float> alpha;
+    std::vector<float> phase;      // Phase du mouvement sinusoïdal (0 à 2π)
+    std::vector<float> speed;      // Vitesse d'oscillation
+    std::vector<float> amplitude;  // Amplitude du mouvement
+    std::vector<float> drift;      // Vitesse de dérive lente vers le haut
+    std::vector<std::uint32_t> seed;       // Générateur de la particule (X de réapparition)
+    std::vector<std::uint8_t> colorIndex;  // Index dans PALETTE
+
+    // Couleurs subtiles : blanc/beige légèrement doré (style poussière/pollen)
+    static const sf::Color PALETTE[4];
+
+    std::size_t count() const { return x.size(); }
+    void clear();
+
+    // Ajoute des particules réparties sur tout le niveau
+    void generate(int particleCount, float levelWidth, float levelHeight, Pcg32& rng);
+
+    // Oscillation et dérive; une particule sortie par le haut réapparaît en bas du niveau
+    void update(float dt, float levelWidth, float levelHeight);
+};
+
+// Rayons de lumière subtils, un tableau par champ
+struct LightRays {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> width;
+    std::vector<float> height;
+    std::vector<float> alpha;
+    std::vector<float> flickerPhase;
+    std::vector<float> flickerSpeed;
+    std::vector<float> angle;  // Angle du rayon (en degrés)
+
+    std::size_t count() const { return x.size(); }
+    void clear();
+
+    // Ajoute des rayons, plutôt vers le haut du niveau
+    void generate(int rayCount, float levelWidth, float levelHeight, Pcg32& rng);
+
+    // Scintillement
+    void update(float dt);
+};
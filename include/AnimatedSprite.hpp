@@ -4,6 +4,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include "TextureAtlas.hpp"
 
 class AnimatedSprite {
 public:
@@ -36,7 +37,10 @@ public:
     bool isPlaying() const { return m_isPlaying; }
 
 private:
-    std::vector<std::shared_ptr<sf::Texture>> m_textures;
+    void applyFrame(int frame);
+
+    TextureAtlas m_atlas;
+    std::vector<int> m_frames;  // Index des frames dans l'atlas
     std::unique_ptr<sf::Sprite> m_sprite;
 
     int m_currentFrame;
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "CookedAssets.hpp"
+
+// Chargement parallèle des images: le décodage (PNG -> sf::Image) se fait sur un
+// pool de threads, l'envoi au GPU sur le thread principal dans pump(), quelques
+// images par frame pour que l'écran de chargement reste fluide. Le temps total
+// est borné par l'image la plus lente plutôt que par la somme de toutes.
+class AssetLoader {
+public:
+    // Appelé sur le thread principal avec l'image décodée (jamais en cas d'échec)
+    using ImageCallback = std::function<void(sf::Image& image, const CookedAssets::Entry& source)>;
+    using TextureCallback = std::function<void(const std::shared_ptr<sf::Texture>& texture, const CookedAssets::Entry& source)>;
+
+    explicit AssetLoader(unsigned int threadCount = 0);  // 0: un thread par coeur
+    ~AssetLoader();  // Les décodages en attente sont abandonnés
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // Décode l'image sur le pool (version cuite si useCooked et qu'elle existe, voir CookedAssets)
+    void loadImage(const std::string& filepath, ImageCallback onLoaded, bool useCooked = false);
+
+    // Texture partagée par ResourceCache: déjà en cache, rien n'est décodé; demandée plusieurs
+    // fois pendant le chargement, elle n'est décodée et envoyée au GPU qu'une fois
+    void loadTexture(const std::string& filepath, TextureCallback onLoaded, bool useCooked = false);
+
+    // Exécute au plus maxCompletions callbacks (envois au GPU); retourne le nombre exécuté
+    std::size_t pump(std::size_t maxCompletions);
+    // Attend et exécute tous les callbacks restants
+    void finish();
+
+    bool isDone() const { return m_completed == m_requested; }
+    float getProgress() const { return m_requested == 0 ? 1.0f : static_cast<float>(m_completed) / m_requested; }
+    std::size_t getRequestedCount() const { return m_requested; }
+    std::size_t getCompletedCount() const { return m_completed; }
+
+private:
+    // image == nullptr si le décodage a échoué
+    using DecodeCallback = std::function<void(sf::Image* image, const CookedAssets::Entry& source)>;
+
+    struct Job {
+        CookedAssets::Entry source;
+        DecodeCallback onDecoded;
+    };
+
+    struct Result {
+        CookedAssets::Entry source;
+        DecodeCallback onDecoded;
+        sf::Image image;
+        bool ok;
+    };
+
+    void submit(CookedAssets::Entry source, DecodeCallback onDecoded);
+    void workerLoop();
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_jobAvailable;
+    std::condition_variable m_resultAvailable;
+    std::deque<Job> m_jobs;
+    std::deque<Result> m_results;
+    bool m_stopping;
+
+    // Thread principal uniquement
+    std::deque<std::function<void()>> m_ready;  // Textures déjà en cache, à livrer par pump()
+    std::unordered_map<std::string, std::vector<TextureCallback>> m_pendingTextures;  // Clé: chemin décodé
+    std::size_t m_requested;
+    std::size_t m_completed;
+};
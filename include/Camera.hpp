@@ -9,14 +9,23 @@ public:
     void update(const sf::Vector2f& targetPosition, sf::Time deltaTime, bool playerIsMoving = false);
     void setPosition(const sf::Vector2f& position);
 
-    sf::View getView() const { return m_view; }
+    // interpolation: 0 = vue au début du dernier tick, 1 = vue actuelle
+    sf::View getView(float interpolation = 1.0f) const;
+    void saveInterpolationState();  // Avant chaque update (et après setPosition)
     sf::Vector2f getPosition() const { return m_view.getCenter(); }
 
+    // Zone du monde visible (boîte englobante de la vue, agrandie de margin pixels)
+    sf::FloatRect getVisibleArea(float margin = 0.0f) const;
+
     void setBounds(float left, float top, float width, float height);
 
 private:
     sf::View m_view;
 
+    // Vue au début du tick (rendu interpolé)
+    sf::Vector2f m_interpolationCenter;
+    float m_interpolationRotation;  // Degrés
+
     // Limites de la caméra (optionnel)
     bool m_hasBounds;
     sf::FloatRect m_bounds;
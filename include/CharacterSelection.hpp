@@ -3,6 +3,8 @@
 #include <SFML/Graphics.hpp>
 #include <memory>
 
+class AssetLoader;
+
 enum class CharacterType {
     Wizard,
     Goat
@@ -12,6 +14,8 @@ class CharacterSelection {
 public:
     CharacterSelection();
 
+    void requestAssets(AssetLoader& loader);  // Previews des personnages
+
     void handleInput(sf::Keyboard::Key key, bool isPressed);
     void render(sf::RenderWindow& window);
 
@@ -21,9 +25,9 @@ public:
 private:
     CharacterType m_selectedCharacter;
     bool m_selectionMade;
-    sf::Font m_font;
+    std::shared_ptr<sf::Font> m_font;  // Partagée via ResourceCache
 
     // Preview textures
-    std::unique_ptr<sf::Texture> m_wizardPreview;
-    std::unique_ptr<sf::Texture> m_goatPreview;
+    std::shared_ptr<sf::Texture> m_wizardPreview;  // Partagées via ResourceCache
+    std::shared_ptr<sf::Texture> m_goatPreview;
 };
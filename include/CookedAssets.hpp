@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+#include <map>
+
+// Assets pré-réduits par la cible CMake `cook_assets` (voir tools/cook_assets.cpp).
+// Si une version cuite d'une image existe, resolve() retourne son chemin et son
+// échelle par rapport à l'original; sinon l'image source est utilisée telle quelle.
+class CookedAssets {
+public:
+    struct Entry {
+        std::string path;       // Chemin à charger
+        float scale = 1.0f;     // Taille chargée / taille originale (1.0 = non cuit)
+        bool mipmaps = false;   // Générer les mipmaps après l'envoi au GPU
+    };
+
+    static CookedAssets& getInstance();
+
+    Entry resolve(const std::string& sourcePath) const;
+    bool isAvailable() const { return !m_entries.empty(); }
+
+    static constexpr const char* COOKED_DIRECTORY = "assets/cooked";
+    static constexpr const char* MANIFEST_FILE = "assets/cooked/manifest.txt";
+
+private:
+    CookedAssets();
+    CookedAssets(const CookedAssets&) = delete;
+    CookedAssets& operator=(const CookedAssets&) = delete;
+
+    void loadManifest();
+
+    std::map<std::string, Entry> m_entries;  // Clé: chemin de l'image source
+};
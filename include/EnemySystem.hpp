@@ -0,0 +1,130 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "ParticleBatch.hpp"
+#include "ParticleSystem.hpp"
+#include "SpatialHash.hpp"
+
+// Ennemis infectés, stockés en structure de tableaux: un tableau contigu par champ
+// (position, échelle, timers, état), l'index d'un ennemi est le même dans chacun.
+// Les mises à jour (timers, angles des orbites, poursuite) sont des boucles sans
+// branche sur des tableaux de float, vectorisées par le compilateur.
+//
+// Un ennemi tué quitte la grille spatiale immédiatement et les tableaux au update()
+// suivant (compaction, l'ordre des survivants est conservé); son explosion continue
+// comme un effet indépendant, ses particules dans un pool commun à tous les ennemis.
+// Les index restent valides jusqu'au prochain update().
+class EnemySystem {
+public:
+    EnemySystem();
+
+    void add(const sf::Vector2f& position, float scale = 1.0f);  // scale: 1.0 = normal, 5.0 = géant
+    void clear();
+
+    // Zone couverte par la grille spatiale (le niveau); reconstruit la grille
+    void setWorldBounds(const sf::FloatRect& worldBounds);
+
+    // Compaction des ennemis tués, animation, explosions et poursuite de la cible (centre du joueur)
+    void update(sf::Time deltaTime, const sf::Vector2f& target);
+
+    // Ennemis vivants dont le corps touche la zone, par index croissant
+    void queryBodies(const sf::FloatRect& area, std::vector<int>& results);
+
+    // Mort spectaculaire: l'ennemi est remplacé par une explosion
+    void kill(std::size_t index);
+
+    // Dégâts de contact
+    bool canDealDamage(std::size_t index) const { return m_damageTimers[index] <= 0.0f; }
+    void resetDamageCooldown(std::size_t index) { m_damageTimers[index] = DAMAGE_COOLDOWN; }
+
+    // Accès par index (les ennemis tués pendant ce tick sont encore comptés)
+    std::size_t size() const { return m_positionsX.size(); }
+    bool isAlive(std::size_t index) const { return m_alive[index] != 0; }
+    sf::Vector2f getPosition(std::size_t index) const { return sf::Vector2f(m_positionsX[index], m_positionsY[index]); }
+    float getScale(std::size_t index) const { return m_scales[index]; }
+    sf::FloatRect getBounds(std::size_t index) const;        // Corps (collisions)
+    sf::FloatRect getRenderBounds(std::size_t index) const;  // Zone couverte par le rendu (orbites comprises)
+    // Corps, puis particules en orbite (lueurs) dans une seconde passe: les orbites de tous
+    // les ennemis passent au-dessus des corps, en deux séquences du batch seulement.
+    // interpolation: 0 = position au début du dernier tick, 1 = position actuelle
+    void render(std::size_t index, ParticleBatch& batch, float interpolation = 1.0f) const;
+    void renderOrbits(std::size_t index, ParticleBatch& batch, float interpolation = 1.0f) const;
+
+    // Mémorise les positions du début du tick (rendu interpolé)
+    void saveInterpolationState();
+
+    // Explosions en cours (onde de choc et flash) et leurs particules
+    std::size_t getDeathEffectCount() const { return m_deathEffects.size(); }
+    sf::FloatRect getDeathEffectBounds(std::size_t effect) const;
+    void renderDeathEffect(std::size_t effect, ParticleBatch& batch) const;
+    void renderDeathParticles(ParticleBatch& batch) const { m_deathParticles.render(batch); }
+
+private:
+    // Visuel de l'ennemi
+    static constexpr float ENEMY_RADIUS = 12.0f;
+    static constexpr float CORE_RADIUS = 8.0f;
+    static constexpr int PARTICLE_COUNT = 8;  // Particules en orbite (multiplié par l'échelle)
+
+    // Comportement
+    static constexpr float DETECTION_RANGE = 300.0f;  // Distance de détection du joueur
+    static constexpr float MOVE_SPEED = 80.0f;         // Vitesse de déplacement
+    static constexpr float DAMAGE_COOLDOWN = 1.0f;    // Cooldown entre les dégâts
+    static constexpr float DEATH_DURATION = 0.6f;     // Durée de l'animation de mort
+    static constexpr float TWO_PI = 2.0f * 3.14159f;
+    static constexpr std::size_t DEATH_PARTICLE_CAPACITY = 4096;  // Particules d'explosion simultanées
+
+    // Explosion d'un ennemi tué: onde de choc et flash (particules dans m_deathParticles)
+    struct DeathEffect {
+        sf::Vector2f position;
+        float scale;
+        float timer;            // Temps restant de l'animation
+        float shockwaveRadius;
+        float shockwaveAlpha;
+    };
+
+    sf::Vector2f getRenderPosition(std::size_t index, float interpolation) const;
+    void compact();         // Retire les ennemis tués en conservant l'ordre
+    void rebuildGrid();
+    void pursue(float dt, const sf::Vector2f& target);
+    void updateDeathEffects(float dt);
+
+    // Un tableau par champ (index = ennemi)
+    std::vector<float> m_positionsX;
+    std::vector<float> m_positionsY;
+    std::vector<float> m_interpolationX;  // Positions au début du tick (mêmes index)
+    std::vector<float> m_interpolationY;
+    std::vector<float> m_scales;
+    std::vector<float> m_pulseTimers;
+    std::vector<float> m_damageTimers;
+    std::vector<float> m_detectionRanges;  // DETECTION_RANGE * échelle
+    std::vector<float> m_moveSpeeds;       // MOVE_SPEED / échelle (plus gros = plus lent)
+    std::vector<float> m_renderRadii;      // Rayon couvert par le corps et les orbites
+    std::vector<std::uint8_t> m_alive;     // 0 = tué, en attente de compaction
+    std::vector<std::uint32_t> m_orbitStarts;  // Première particule en orbite de l'ennemi
+    std::vector<std::uint32_t> m_orbitCounts;
+    std::size_t m_killedCount;
+
+    // Particules en orbite de tous les ennemis, contiguës par ennemi
+    std::vector<float> m_orbitAngles;  // Radians, entre 0 et 2π
+    std::vector<float> m_orbitSpeeds;  // Radians par seconde
+    std::vector<float> m_orbitRadii;
+    std::vector<float> m_orbitSizes;
+    std::vector<sf::Color> m_orbitColors;
+
+    std::vector<DeathEffect> m_deathEffects;
+    ParticleSystem m_deathParticles;
+
+    // Corps des ennemis vivants (identifiant = index)
+    SpatialHash m_grid;
+    sf::FloatRect m_worldBounds;
+    float m_maxDetectionRange;  // Rayon de la requête de poursuite
+
+    // Tampons de la poursuite (ennemis proches de la cible, rangés de façon contiguë)
+    std::vector<int> m_candidates;
+    std::vector<float> m_stepX;
+    std::vector<float> m_stepY;
+    std::vector<float> m_stepRange;
+    std::vector<float> m_stepSpeed;
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+// Approximations polynomiales de sin/cos, sans branche ni appel de bibliothèque:
+// utilisables dans les boucles que le compilateur vectorise. Erreur absolue
+// inférieure à 1e-5 sur quelques tours; pour de grands angles, l'erreur est celle
+// de la précision du float en entrée.
+namespace FastMath {
+    constexpr float PI = 3.14159265f;
+    constexpr float TWO_PI = 2.0f * PI;
+    constexpr float HALF_PI = 0.5f * PI;
+
+    inline float sin(float x) {
+        // Réduction à [-π, π] (arrondi au tour le plus proche)
+        float turns = x * (1.0f / TWO_PI);
+        turns -= static_cast<float>(static_cast<int>(turns + (turns >= 0.0f ? 0.5f : -0.5f)));
+        x = turns * TWO_PI;
+
+        // sin(π - x) = sin(x): réduction à [-π/2, π/2]
+        x = x > HALF_PI ? PI - x : (x < -HALF_PI ? -PI - x : x);
+
+        // Série de Taylor jusqu'à x^9
+        float x2 = x * x;
+        return x * (1.0f + x2 * (-1.0f / 6.0f + x2 * (1.0f / 120.0f + x2 * (-1.0f / 5040.0f + x2 * (1.0f / 362880.0f)))));
+    }
+
+    inline float cos(float x) {
+        return sin(x + HALF_PI);
+    }
+}
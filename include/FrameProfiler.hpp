@@ -0,0 +1,124 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <chrono>
+#include <string>
+
+// Étapes mesurées dans une frame. Les étapes "imbriquées" sont incluses dans
+// une autre (collision et ambiance dans le niveau, tiles dans le monde) et ne
+// sont pas empilées dans le graphe.
+enum class ProfileStage {
+    Events,        // Game::processEvents
+    PlayerUpdate,  // Player::update
+    LevelUpdate,   // Level::update (collisions, ambiance, ennemis)
+    Collision,     // Level::handlePlayerCollision (dans LevelUpdate)
+    Ambient,       // Level::updateAmbientEffects (dans LevelUpdate)
+    WorldRender,   // Level::render + Player::render
+    TileRender,    // Tilemap::render (dans WorldRender)
+    Hud,           // Barre de vie, titres, menus
+    Display,       // RenderWindow::display (inclut l'attente de la synchro)
+    Count
+};
+
+// Profileur de frames: temps par étape accumulés dans la frame courante, puis
+// conservés dans un tampon circulaire pour le graphe et les percentiles.
+// Rien n'est mesuré tant que l'overlay est masqué (un test de booléen par scope).
+class FrameProfiler {
+public:
+    static constexpr std::size_t STAGE_COUNT = static_cast<std::size_t>(ProfileStage::Count);
+    static constexpr std::size_t HISTORY_SIZE = 600;  // 10 secondes à 60 FPS
+
+    static FrameProfiler& getInstance();
+
+    // Active la mesure et l'overlay (F4)
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return m_enabled; }
+
+    // Délimitent une frame de Game::run
+    void beginFrame();
+    void endFrame();
+
+    // Ajoute du temps à une étape de la frame courante (une étape peut être mesurée plusieurs fois par frame)
+    void addSample(ProfileStage stage, float milliseconds) {
+        m_current[static_cast<std::size_t>(stage)] += milliseconds;
+    }
+
+    // Percentiles glissants (ms) sur l'historique
+    struct StageStats {
+        float p50 = 0.0f;
+        float p95 = 0.0f;
+        float p99 = 0.0f;
+    };
+    const StageStats& getStats(ProfileStage stage) const { return m_stats[static_cast<std::size_t>(stage)]; }
+    const StageStats& getFrameStats() const { return m_frameStats; }
+
+    // Graphe empilé des dernières frames + tableau des percentiles (vue par défaut)
+    void render(sf::RenderTarget& target, const sf::Font& font);
+
+    // Écrit l'historique (une ligne par frame, une colonne par étape) si des frames ont été mesurées
+    bool dumpCsv(const std::string& filepath) const;
+
+    static const char* getStageName(ProfileStage stage);
+
+private:
+    FrameProfiler();
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    void updateStats();
+
+    struct FrameSample {
+        std::array<float, STAGE_COUNT> stages{};
+        float total = 0.0f;
+    };
+
+    bool m_enabled;
+    bool m_inFrame;
+    std::chrono::steady_clock::time_point m_frameStart;
+    std::array<float, STAGE_COUNT> m_current{};
+
+    std::array<FrameSample, HISTORY_SIZE> m_history;
+    std::size_t m_head;         // Prochain emplacement à écrire
+    std::size_t m_count;        // Frames valides dans l'historique
+    std::size_t m_frameNumber;  // Frames mesurées depuis le lancement (pour le CSV)
+
+    std::array<StageStats, STAGE_COUNT> m_stats;
+    StageStats m_frameStats;
+    int m_framesSinceStats;
+
+    static constexpr int STATS_INTERVAL = 15;       // Recalcul des percentiles toutes les N frames
+    static constexpr float GRAPH_SCALE_MS = 33.3f;  // Hauteur du graphe = 2 frames à 60 FPS
+};
+
+// Mesure la durée de vie du scope et l'ajoute à une étape. Sans effet (pas
+// d'appel à l'horloge) si le profileur est désactivé à la construction.
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileStage stage)
+        : m_stage(stage)
+        , m_active(FrameProfiler::getInstance().isEnabled())
+    {
+        if (m_active) {
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ProfileScope() { stop(); }
+
+    // Termine la mesure avant la fin du scope
+    void stop() {
+        if (!m_active) return;
+        m_active = false;
+        std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - m_start;
+        FrameProfiler::getInstance().addSample(m_stage, elapsed.count());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    ProfileStage m_stage;
+    bool m_active;
+    std::chrono::steady_clock::time_point m_start;
+};
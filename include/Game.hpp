@@ -2,13 +2,16 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
+#include <future>
 #include <memory>
+#include "AssetLoader.hpp"
 #include "Player.hpp"
 #include "PauseMenu.hpp"
 #include "Camera.hpp"
 #include "Level.hpp"
 #include "LevelEditor.hpp"
 #include "CharacterSelection.hpp"
+#include "Hud.hpp"
 
 class Game {
 public:
@@ -20,21 +23,37 @@ public:
 private:
     void processEvents();
     void update(sf::Time deltaTime);
-    void render();
+    void saveInterpolationState();       // Joueur, ennemis et caméra au début d'un tick
+    void render(float interpolation);    // 0 = état du tick précédent, 1 = état actuel
+
+    // Écran de progression affiché jusqu'à la fin du loader (envois au GPU par petits lots)
+    void runLoadingScreen(AssetLoader& loader);
+    void renderLoadingScreen(float progress);
 
     void handlePlayerInput(sf::Keyboard::Key key, bool isPressed);
     void handleMenuInput(sf::Keyboard::Key key);
 
-    void showVictoryMessage();
     void showFinalVictoryMenu();
     void showGameOverMenu();
     void showLevelSelectMenu();
     void loadNextLevel();
+    void startPreload(int levelNumber);
+    void cancelPreload();  // Avant tout chargement de niveau sur le thread principal
     void restartGame();
     void loadLevel(int levelNumber);
 
+    // Niveau suivant préparé sur un thread de chargement pendant l'écran de victoire
+    struct PreparedLevel {
+        std::unique_ptr<Level> level;  // nullptr si le chargement a échoué
+        bool valid = false;            // Fichier présent avec ses deux portails
+    };
+    static PreparedLevel prepareLevel(std::unique_ptr<Level> level, int levelNumber);
+
 private:
     static const sf::Time TimePerFrame;
+    static constexpr int MAX_STEPS_PER_FRAME = 5;  // Pas de rattrapage max par frame (spirale de la mort)
+    static constexpr unsigned int FALLBACK_FRAMERATE_LIMIT = 300;  // Si le pilote ignore la vsync
+    static constexpr std::size_t UPLOADS_PER_FRAME = 4;  // Textures envoyées au GPU par frame de chargement
 
     sf::RenderWindow m_window;
     std::unique_ptr<CharacterSelection> m_characterSelection;
@@ -43,6 +62,9 @@ private:
     std::unique_ptr<Camera> m_camera;
     std::unique_ptr<Level> m_level;
     std::unique_ptr<LevelEditor> m_editor;
+    std::unique_ptr<Hud> m_hud;
+    std::future<PreparedLevel> m_preload;
+    int m_preloadLevelNumber;
 
     bool m_isSelectingCharacter;
     bool m_isPaused;
@@ -51,9 +73,11 @@ private:
     bool m_isGameComplete;  // Vrai quand tous les niveaux sont terminés
     bool m_isGameOver;      // Vrai quand le joueur est mort (0 HP)
     bool m_isLevelSelectOpen; // Menu de sélection de niveau (cheat code)
+    bool m_showRenderStats;   // Statistiques de culling affichées (F3)
     int m_currentLevelNumber;  // 0 = prologue, 1+ = niveaux numérotés
     int m_selectedLevelInMenu; // Niveau sélectionné dans le menu
-    sf::Font m_font;
+    std::shared_ptr<sf::Font> m_font;  // Partagée via ResourceCache
+    std::shared_ptr<SdfFont> m_titleFont;  // Grands titres (atlas SDF, partagé avec le HUD)
 
     // Musique
     sf::Music m_backgroundMusic;
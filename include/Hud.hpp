@@ -0,0 +1,68 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+#include "SdfFont.hpp"
+
+// Interface en jeu en mode retenu: barre de vie, bannière du niveau et message de
+// fin de niveau sont construits une fois, puis composés dans une RenderTexture
+// seulement quand ce qu'ils affichent change. Le reste du temps, le HUD se
+// résume à un seul quad dessiné dans la fenêtre.
+class Hud {
+public:
+    enum class Banner {
+        None,
+        Title,       // "BoooBee" (prologue)
+        DoubleJump,  // "NOUVEAU POUVOIR" (niveau 4)
+        HeroCharge   // "NOUVEAU POUVOIR" (niveau 8)
+    };
+
+    // Les grands titres passent par la police SDF (aucune taille rastérisée à leur apparition)
+    Hud(std::shared_ptr<sf::Font> font, std::shared_ptr<SdfFont> titleFont, sf::Vector2u size);
+
+    // Les setters ne marquent le HUD à recomposer que si la valeur change
+    void setHealth(int health, int maxHealth);
+    void setBanner(Banner banner);
+    void setLevelComplete(bool complete);
+
+    void render(sf::RenderTarget& target);  // Dans la vue par défaut
+    std::size_t getRebuildCount() const { return m_rebuildCount; }
+
+private:
+    void buildHealthBar();
+    void buildBanners();
+    void buildLevelComplete();
+    void updateHealthBar();
+    void rebuild();
+
+    std::shared_ptr<sf::Font> m_font;
+    std::shared_ptr<SdfFont> m_titleFont;
+    sf::RenderTexture m_layer;
+    std::unique_ptr<sf::Sprite> m_layerSprite;
+    bool m_dirty;
+    std::size_t m_rebuildCount;
+
+    // État affiché
+    int m_health;
+    int m_maxHealth;
+    Banner m_banner;
+    bool m_levelComplete;
+
+    // Barre de vie
+    sf::RectangleShape m_healthBackground;
+    sf::RectangleShape m_healthBar;
+    sf::RectangleShape m_healthGlow;
+    std::unique_ptr<sf::Text> m_healthText;
+
+    // Bannières (halo rectangulaire derrière le texte)
+    std::unique_ptr<SdfText> m_titleText;
+    std::vector<sf::RectangleShape> m_titleGlow;
+    std::unique_ptr<SdfText> m_powerText;
+    std::vector<sf::RectangleShape> m_powerGlow;
+    std::unique_ptr<sf::Text> m_powerSubText;
+
+    // Fin de niveau
+    sf::RectangleShape m_overlay;
+    std::unique_ptr<SdfText> m_finishText;
+};
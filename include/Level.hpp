@@ -3,42 +3,41 @@
 #include <SFML/Graphics.hpp>
 #include "Tilemap.hpp"
 #include "Player.hpp"
-#include "Enemy.hpp"
+#include "EnemySystem.hpp"
+#include "Camera.hpp"
+#include "ParticleBatch.hpp"
+#include "AmbientParticles.hpp"
 #include <memory>
 #include <vector>
 
+class AssetLoader;
+
 class Level {
 public:
-    // Particule ambiante flottante (poussière, spore, pollen)
-    struct AmbientParticle {
-        sf::Vector2f position;
-        sf::Vector2f basePosition;  // Position de base pour l'oscillation
-        float size;
-        float alpha;
-        float oscillationPhase;     // Phase pour le mouvement sinusoïdal
-        float oscillationSpeed;     // Vitesse d'oscillation
-        float oscillationAmplitude; // Amplitude du mouvement
-        float driftSpeed;           // Vitesse de dérive lente
-        sf::Color color;
+    // Statistiques de culling du dernier rendu (objets du monde dessinés / ignorés)
+    struct RenderStats {
+        int drawn = 0;
+        int culled = 0;
+        int drawnChunks = 0;   // Chunks de tiles dessinés
+        int culledChunks = 0;  // Chunks de tiles hors de la vue
     };
 
-    // Rayon de lumière subtil
-    struct LightRay {
-        sf::Vector2f position;
-        float width;
-        float height;
-        float alpha;
-        float flickerPhase;
-        float flickerSpeed;
-        float angle;  // Angle du rayon (en degrés)
-    };
+    explicit Level(bool headless = false);  // headless: aucune texture chargée (simulation)
 
-    Level();
+    // Niveau vide à remplir hors du thread du rendu (loadFromFile, generateEnemies): reprend
+    // le tileset et la porte de `resources` sans rien relire; finishPreload() sur le thread du
+    // rendu envoie ensuite la géométrie des tiles au GPU
+    static std::unique_ptr<Level> createForPreload(const Level& resources);
+    void finishPreload();
 
-    bool load();
+    // Tileset et porte décodés en parallèle par le loader, envoyés au GPU par loader.pump()
+    void requestAssets(AssetLoader& loader);
+    bool load();  // Niveau prologue
     bool loadFromFile(const std::string& filepath);
     void update(sf::Time deltaTime, Player& player);
-    void render(sf::RenderWindow& window);
+    void render(sf::RenderWindow& window, const Camera& camera, float interpolation = 1.0f);  // Ennemis interpolés
+    void saveInterpolationState() { m_enemies.saveInterpolationState(); }
+    const RenderStats& getRenderStats() const { return m_renderStats; }
 
     // Collision avec le joueur
     void handlePlayerCollision(Player& player);
@@ -60,20 +59,33 @@ public:
     int getWidth() const { return m_tilemap->getWidth(); }
     int getHeight() const { return m_tilemap->getHeight(); }
     int getTileSize() const { return m_tilemap->getTileSize(); }
+    Tilemap& getTilemap() { return *m_tilemap; }
 
     // Gestion des ennemis
     void addEnemy(const sf::Vector2f& position, float scale = 1.0f);
-    const std::vector<std::unique_ptr<Enemy>>& getEnemies() const { return m_enemies; }
+    const EnemySystem& getEnemies() const { return m_enemies; }
     void generateEnemies(int levelNumber);
 
     // Décor ambiant
     void generateAmbientParticles();
     void updateAmbientEffects(sf::Time deltaTime);
-    void renderAmbientBackground(sf::RenderWindow& window);  // Derrière les tiles
-    void renderAmbientForeground(sf::RenderWindow& window);  // Devant les tiles
+    void renderAmbientBackground(ParticleBatch& batch, const sf::FloatRect& visibleArea);  // Derrière les tiles
+    void renderAmbientForeground(ParticleBatch& batch, const sf::FloatRect& visibleArea);  // Devant les tiles
 
 private:
+    Level(bool headless, const Level* resources);
+    void setDoorTexture(std::shared_ptr<sf::Texture> texture);  // Crée les sprites des deux portes
+
     void createSimpleLevel();
+    void updateEnemies(sf::Time deltaTime, Player& player);  // Animation, poursuite, charge et dégâts de contact
+    bool isVisible(const sf::FloatRect& bounds, const sf::FloatRect& visibleArea);  // Compte aussi les stats
+
+    // Debug constants
+    static constexpr bool SHOW_DEBUG_CULLING_STATS = false; // Mettre à true pour afficher les stats de culling dans la console
+    static constexpr bool SHOW_DEBUG_COLLISIONS = false;    // Mettre à true pour afficher l'état des collisions du joueur
+
+    // Marge autour de la vue pour le culling (évite les apparitions en bord d'écran)
+    static constexpr float CULLING_MARGIN = 64.0f;
 
 private:
     std::unique_ptr<Tilemap> m_tilemap;
@@ -87,20 +99,25 @@ private:
     sf::Vector2f m_exitPortalPosition;
     bool m_hasExitPortal;
 
-    // Porte médiévale
-    sf::Texture m_doorTexture;
+    // Porte médiévale (texture partagée entre un niveau et celui qu'il précharge)
+    std::shared_ptr<sf::Texture> m_doorTexture;
     std::unique_ptr<sf::Sprite> m_entranceDoorSprite;
     std::unique_ptr<sf::Sprite> m_exitDoorSprite;
     bool m_doorTextureLoaded;
 
     // Info du niveau
     bool m_isPrologueLevel;  // true si c'est le niveau prologue
+    bool m_headless;         // Pas de ressources graphiques (simulation)
 
-    // Ennemis
-    std::vector<std::unique_ptr<Enemy>> m_enemies;
+    // Ennemis (tableaux contigus et grille spatiale)
+    EnemySystem m_enemies;
+    std::vector<int> m_nearbyEnemies;  // Résultat de requête réutilisé d'un tick à l'autre
+    std::vector<std::size_t> m_visibleEnemies;  // Ennemis visibles de la frame (passe des orbites)
 
-    // Décor ambiant
-    std::vector<AmbientParticle> m_ambientParticles;
-    std::vector<LightRay> m_lightRays;
+    // Décor ambiant (un tableau par champ)
+    AmbientParticles m_ambientParticles;
+    LightRays m_lightRays;
     float m_ambientTimer;
+
+    RenderStats m_renderStats;
 };
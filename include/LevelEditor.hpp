@@ -4,6 +4,9 @@
 #include <memory>
 #include <vector>
 #include "Tilemap.hpp"
+#include "LevelFile.hpp"
+
+class AssetLoader;
 
 class LevelEditor {
 public:
@@ -24,6 +27,8 @@ public:
 
     LevelEditor(int tileSize = 64);
 
+    void requestAssets(AssetLoader& loader);  // Tileset de la palette
+
     void handleInput(sf::Event& event, const sf::RenderWindow& window);
     void update(sf::Time deltaTime);
     void render(sf::RenderWindow& window);
@@ -89,6 +94,7 @@ private:
     int m_height;
     std::vector<std::vector<int>> m_levelData;
     std::vector<EnemyPlacement> m_enemies;
+    std::vector<LevelData::GiantEnemyRecord> m_giantEnemies;  // Non éditables, conservés à la sauvegarde
 
     // Portails
     bool m_hasExitPortal;
@@ -112,7 +118,7 @@ private:
     bool m_isPaused;  // Flag pour indiquer que l'éditeur est en pause
 
     // Interface
-    sf::Font m_font;
+    std::shared_ptr<sf::Font> m_font;  // Partagée via ResourceCache
     std::shared_ptr<sf::Texture> m_tileset;
     int m_tilesetWidthInTiles;
 
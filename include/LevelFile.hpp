@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Contenu d'un fichier de niveau, indépendant du format (JSON ou binaire).
+// Les positions sont en coordonnées de tiles.
+struct LevelData {
+    struct Portal {
+        bool present = false;
+        int x = 0;
+        int y = 0;
+    };
+
+    struct EnemyRecord {
+        std::int32_t x;
+        std::int32_t y;
+        std::int32_t type;   // Type d'ennemi (0 = basique, etc.)
+    };
+
+    struct GiantEnemyRecord {
+        std::int32_t x;
+        std::int32_t y;
+        float scale;
+    };
+
+    int width = 0;
+    int height = 0;
+    std::vector<std::int16_t> tiles;   // Ligne par ligne (index = y * width + x), -1 = vide
+    Portal entrance;
+    Portal exit;
+    std::vector<EnemyRecord> enemies;          // Placements de l'éditeur
+    std::vector<GiantEnemyRecord> giantEnemies;
+
+    int getTile(int x, int y) const { return tiles[static_cast<std::size_t>(y) * width + x]; }
+};
+
+// Lecture / écriture des niveaux.
+//
+// Format binaire (.bblv), entiers little-endian:
+//   en-tête de 40 octets: "BBLV", version (u16), drapeaux (u16: bit 0 = entrée, bit 1 = sortie),
+//   largeur, hauteur, entrée x/y, sortie x/y (i32), nombre d'ennemis, nombre d'ennemis géants (u32)
+//   puis les tiles (i16, ligne par ligne), complétées à un multiple de 4 octets,
+//   puis les ennemis (x, y, type: i32) et les ennemis géants (x, y: i32, scale: f32).
+// Le fichier est projeté en mémoire (mmap) et les tableaux sont copiés tels quels.
+namespace LevelFile {
+    constexpr std::uint16_t BINARY_VERSION = 1;
+    extern const char* const BINARY_EXTENSION;  // ".bblv"
+
+    // Charge un niveau. Pour un chemin .json, la version binaire voisine est utilisée
+    // si elle existe et n'est pas plus ancienne que le JSON.
+    bool load(const std::string& filepath, LevelData& data);
+
+    bool loadJson(const std::string& filepath, LevelData& data);
+    bool loadBinary(const std::string& filepath, LevelData& data);
+
+    bool saveJson(const std::string& filepath, const LevelData& data);
+    bool saveBinary(const std::string& filepath, const LevelData& data);
+
+    // Chemin de la version binaire d'un niveau JSON (levels/level_1.json -> levels/level_1.bblv)
+    std::string binaryPathFor(const std::string& jsonPath);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Batch partagé pour toutes les particules et effets circulaires.
+// Chaque disque est un quad texturé (disque pré-rasterisé dans une petite texture),
+// chaque anneau/quad utilise un texel blanc de la même texture: tout ce qui est
+// ajouté entre deux flush() est dessiné en mélange alpha, dans l'ordre d'ajout.
+// Les lueurs (addGlow) sont ombrées par un shader: les sommets sont découpés en
+// séquences (texturée / lueur) dessinées dans l'ordre d'ajout, un draw call par
+// séquence. Un draw call de plus seulement à chaque alternance entre formes pleines et lueurs.
+class ParticleBatch {
+public:
+    static ParticleBatch& getInstance();
+
+    // Disque plein (équivalent à un sf::CircleShape centré sans contour)
+    void addCircle(const sf::Vector2f& center, float radius, const sf::Color& color);
+
+    // Disque à bord doux (intensité décroissante du centre vers le bord)
+    void addSoftCircle(const sf::Vector2f& center, float radius, const sf::Color& color);
+
+    // Anneau à l'extérieur du rayon (équivalent au contour d'un sf::CircleShape)
+    void addRing(const sf::Vector2f& center, float radius, float thickness, const sf::Color& color);
+
+    // Lueur en un seul quad: noyau plein de rayon coreRadius, puis halo décroissant jusqu'à radius.
+    // intensity = opacité du halo relative au noyau (remplace les disques concentriques empilés),
+    // coreWhiteness = teinte du noyau vers le blanc (0 = couleur du halo, 1 = blanc)
+    void addGlow(const sf::Vector2f& center, float radius, float coreRadius, const sf::Color& color, float intensity,
+                 float coreWhiteness = 0.0f);
+
+    // Quadrilatère quelconque (points dans l'ordre du contour)
+    void addQuad(const sf::Vector2f& p0, const sf::Vector2f& p1, const sf::Vector2f& p2, const sf::Vector2f& p3,
+                 const sf::Color& color);
+
+    // Dessine tout ce qui a été ajouté (déplacé par transform) puis vide le batch
+    void flush(sf::RenderTarget& target, const sf::Transform& transform = sf::Transform::Identity);
+
+    // Statistiques du dernier flush
+    int getLastDrawCalls() const { return m_lastDrawCalls; }
+    std::size_t getLastVertexCount() const { return m_lastVertexCount; }
+
+private:
+    ParticleBatch();
+    ParticleBatch(const ParticleBatch&) = delete;
+    ParticleBatch& operator=(const ParticleBatch&) = delete;
+
+    bool createTexture();
+    bool createGlowShader();
+    std::vector<sf::Vertex>& texturedRun();  // Sommets texturés, à la suite de la séquence en cours
+    void beginRun(bool glow);                // Nouvelle séquence si le type change
+    void addTexturedQuad(const sf::Vector2f& center, float radius, const sf::Color& color, float texOffsetX);
+
+    std::vector<sf::Vertex> m_vertices;
+
+    // Séquences de m_vertices: les lueurs y ont pour coordonnées de texture leurs paramètres (voir addGlow)
+    struct Run {
+        bool glow;
+        std::size_t start;  // Premier sommet de la séquence
+    };
+    std::vector<Run> m_runs;
+
+    sf::Texture m_texture;
+    bool m_textureReady;
+    bool m_textureFailed;
+
+    sf::Shader m_glowShader;
+    bool m_glowShaderReady;
+    bool m_glowShaderFailed;  // Pas de shaders: addGlow retombe sur deux disques texturés
+
+    int m_lastDrawCalls;
+    std::size_t m_lastVertexCount;
+
+    // Texture: [0, 64) disque net, [64, 128) disque doux, [128, 192) blanc uni
+    static constexpr unsigned int CELL_SIZE = 64;
+    static constexpr float HARD_DISC_OFFSET = 0.0f;
+    static constexpr float SOFT_DISC_OFFSET = 64.0f;
+    static constexpr float WHITE_TEXEL_X = 160.0f;
+    static constexpr float WHITE_TEXEL_Y = 32.0f;
+    static constexpr int RING_SEGMENTS = 32;
+};
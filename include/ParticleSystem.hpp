@@ -1,39 +1,113 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <vector>
-#include <memory>
+#include "ParticleBatch.hpp"
+#include "Random.hpp"
 
 struct Particle {
     sf::Vector2f position;
     sf::Vector2f velocity;
     sf::Color color;
-    float lifetime;
-    float maxLifetime;
-    float size;
+    float age;       // Secondes depuis l'émission
+    float lifetime;  // Durée de vie totale
+    float size;      // Taille à l'émission (modulée par la courbe de taille)
 };
 
+// Valeur interpolée linéairement sur la vie d'une particule (0 = émission, 1 = fin)
+struct LifetimeCurve {
+    float start = 1.0f;
+    float end = 1.0f;
+
+    float at(float progress) const { return start + (end - start) * progress; }
+};
+
+// Description d'un effet: tirages à l'émission, évolution et rendu des particules
+struct ParticleEffect {
+    // Émission
+    float angleMin = 0.0f;          // Direction (radians)
+    float angleMax = 2.0f * 3.14159f;
+    bool ring = false;              // Directions réparties régulièrement dans une salve (+ angleJitter)
+    float angleJitter = 0.0f;
+    float speedMin = 0.0f;
+    float speedMax = 0.0f;
+    sf::Vector2f velocityOffset;    // Ajouté à la vitesse tirée
+    float sizeMin = 1.0f;
+    float sizeMax = 1.0f;
+    float lifetimeMin = 1.0f;
+    float lifetimeMax = 1.0f;
+    std::array<sf::Color, 4> palette = {sf::Color::White, sf::Color::White, sf::Color::White, sf::Color::White};
+    int paletteSize = 1;
+
+    // Évolution
+    float gravity = 0.0f;
+    float friction = 1.0f;          // Facteur appliqué à la vitesse par pas de 1/60 s
+    LifetimeCurve sizeOverLife;
+    LifetimeCurve alphaOverLife = {1.0f, 0.0f};
+
+    // Rendu: halo (rayon et alpha relatifs, 0 = aucun) et coeur blanc
+    float haloScale = 0.0f;
+    float haloAlpha = 0.0f;
+    float coreScale = 0.0f;
+    float coreAlpha = 0.0f;
+};
+
+// Pool de particules de capacité fixe: la mémoire est réservée à la construction,
+// une émission est un ajout en fin de tableau et une mort un échange avec la
+// dernière particule (O(1), l'ordre n'est pas conservé). Au-delà de la capacité,
+// les nouvelles particules sont ignorées: aucune allocation pendant le jeu.
 class ParticleSystem {
 public:
-    ParticleSystem();
+    ParticleSystem(const ParticleEffect& effect, std::size_t capacity);
+
+    // Salve de particules tirées selon l'effet (scale multiplie la taille)
+    void burst(const sf::Vector2f& position, int count, float scale = 1.0f);
+    void burst(const sf::Vector2f& position, int count, const sf::Color& color, float scale = 1.0f);
 
-    // Crée un effet de désintégration à une position donnée
-    void createDisintegrationEffect(const sf::Vector2f& position, const sf::Color& baseColor);
+    // Particule explicite (durée de vie tirée selon l'effet)
+    void spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, float size, const sf::Color& color);
+
+    // Émetteurs continus (particules par seconde); retourne -1 si tous les emplacements sont pris.
+    // Un identifiant invalide (-1 compris) est ignoré par les setters et removeEmitter
+    int addEmitter(const sf::Vector2f& position, float rate);
+    void setEmitterPosition(int emitter, const sf::Vector2f& position);
+    void setEmitterRate(int emitter, float rate);
+    void removeEmitter(int emitter);
 
     void update(sf::Time deltaTime);
-    void render(sf::RenderWindow& window);
+    void render(ParticleBatch& batch) const;  // Ajoute les particules au batch partagé
+    void clear();                             // Retire les particules (les émetteurs restent)
 
     bool isActive() const { return !m_particles.empty(); }
+    std::size_t getCount() const { return m_particles.size(); }
+    std::size_t getCapacity() const { return m_capacity; }
+
+    static constexpr int MAX_EMITTERS = 8;
 
 private:
-    std::vector<Particle> m_particles;
+    struct Emitter {
+        sf::Vector2f position;
+        float rate = 0.0f;
+        float accumulator = 0.0f;  // Fraction de particule en attente
+        bool active = false;
+    };
+
+    void emit(const sf::Vector2f& position, float angle, const sf::Color& color, float scale);
+    float burstAngle(int index, int count, Pcg32& rng) const;
 
-    // Constantes pour l'effet de désintégration
-    static constexpr int PARTICLE_COUNT = 50;
-    static constexpr float PARTICLE_LIFETIME = 1.5f;
-    static constexpr float PARTICLE_MIN_SIZE = 2.0f;
-    static constexpr float PARTICLE_MAX_SIZE = 6.0f;
-    static constexpr float PARTICLE_MIN_SPEED = 50.0f;
-    static constexpr float PARTICLE_MAX_SPEED = 200.0f;
-    static constexpr float GRAVITY = 200.0f;
+    ParticleEffect m_effect;
+    std::size_t m_capacity;
+    std::vector<Particle> m_particles;
+    std::array<Emitter, MAX_EMITTERS> m_emitters;
 };
+
+// Effets du jeu
+namespace ParticleEffects {
+    constexpr int DISINTEGRATION_COUNT = 50;
+    constexpr int HERO_CHARGE_COUNT = 24;
+
+    ParticleEffect disintegration();      // Mort du joueur (couleur donnée à l'émission)
+    ParticleEffect heroChargeExplosion(); // Déclenchement de la charge héroïque
+    ParticleEffect enemyDeath();          // Explosion d'un ennemi tué (taille selon l'échelle)
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -35,7 +36,7 @@ private:
     std::vector<sf::RectangleShape> m_itemBoxes;
 
     // Police et textes
-    sf::Font m_font;
+    std::shared_ptr<sf::Font> m_font;  // Partagée via ResourceCache
     std::vector<std::unique_ptr<sf::Text>> m_menuTexts;
     std::unique_ptr<sf::Text> m_titleText;
 
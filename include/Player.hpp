@@ -4,8 +4,11 @@
 #include <SFML/Audio.hpp>
 #include <memory>
 #include "ParticleSystem.hpp"
+#include "TextureAtlas.hpp"
 #include "CharacterSelection.hpp"
 
+class AssetLoader;
+
 class Player {
 public:
     enum class State {
@@ -17,14 +20,27 @@ public:
         UsingPower
     };
 
-    Player(CharacterType characterType = CharacterType::Wizard);
+    // headless: ni textures ni sons (simulation sans fenêtre)
+    // loader: les frames y sont décodées en parallèle, finishLoading() construit l'atlas quand il
+    // a terminé; sans loader, tout est chargé dans le constructeur
+    Player(CharacterType characterType = CharacterType::Wizard, bool headless = false, AssetLoader* loader = nullptr);
+    void finishLoading();
 
     void handleInput(sf::Keyboard::Key key, bool isPressed);
     void update(sf::Time deltaTime);
-    void render(sf::RenderWindow& window);
+    // interpolation: fraction du tick en cours écoulée (0 = état du tick précédent, 1 = état actuel)
+    void render(sf::RenderWindow& window, float interpolation = 1.0f);
+
+    // Mémorise l'état affiché au début d'un tick (appelé avant chaque update, et après une téléportation)
+    void saveInterpolationState() { m_interpolationPosition = m_position; }
 
     sf::Vector2f getPosition() const { return m_position; }
-    void setPosition(const sf::Vector2f& position) { m_position = position; }
+    // Téléportation: le prochain balayage de collision part de cette position
+    void setPosition(const sf::Vector2f& position) { m_position = position; m_previousPosition = position; }
+    // Position avant l'intégration du dernier pas (départ du balayage de collision, voir Level::handlePlayerCollision)
+    sf::Vector2f getPreviousPosition() const { return m_previousPosition; }
+    // Pas déjà intégré de from à to, à résoudre par le prochain balayage (benchmarks)
+    void setStep(const sf::Vector2f& from, const sf::Vector2f& to) { m_previousPosition = from; m_position = to; }
 
     sf::Vector2f getVelocity() const { return m_velocity; }
     void setVelocity(const sf::Vector2f& velocity) { m_velocity = velocity; }
@@ -73,11 +89,16 @@ public:
 private:
     void updatePhysics(sf::Time deltaTime);
     void updateAnimation(sf::Time deltaTime);
-    void loadAnimationFrames(const std::string& directory, const std::string& prefix, int frameCount, std::vector<std::shared_ptr<sf::Texture>>& textures);
-    void loadSpriteSheet(const std::string& filepath, int frameWidth, int frameHeight, int totalFrames, std::vector<std::shared_ptr<sf::Texture>>& textures);
+    void requestFrames(AssetLoader& loader);
+    void loadAnimationFrames(AssetLoader& loader, const std::string& directory, const std::string& prefix, int frameCount, std::vector<int>& frames);
+    void loadFrame(AssetLoader& loader, const std::string& filepath, std::vector<int>& frames);  // -1 jusqu'au décodage
+    void loadSpriteSheet(const std::string& filepath, int frameWidth, int frameHeight, int totalFrames, std::vector<int>& frames);
+    void applyFrame(int frameIndex);  // Affiche une frame de l'atlas (change seulement le rect de texture)
 
 private:
     sf::Vector2f m_position;
+    sf::Vector2f m_previousPosition;
+    sf::Vector2f m_interpolationPosition;  // Position au début du tick (rendu interpolé)
     sf::Vector2f m_velocity;
 
     State m_state;
@@ -108,17 +129,23 @@ private:
     float m_spriteScale;  // Scale du sprite (varie selon le personnage)
     float m_animationSpeed;  // Multiplicateur de vitesse d'animation (1.0 = normal, 2.0 = deux fois plus lent)
 
-    // Animations
-    std::vector<std::shared_ptr<sf::Texture>> m_idleTextures;
-    std::vector<std::shared_ptr<sf::Texture>> m_walkTextures;
-    std::vector<std::shared_ptr<sf::Texture>> m_jumpTextures;
+    // Animations (index des frames dans l'atlas), partagées via ResourceCache entre les
+    // joueurs d'un même personnage: un nouveau joueur ne relit aucune frame
+    struct Animations {
+        TextureAtlas atlas;
+        std::vector<int> idleFrames;
+        std::vector<int> walkFrames;
+        std::vector<int> jumpFrames;
+        bool built = false;  // Atlas envoyé au GPU
+    };
+    std::shared_ptr<Animations> m_animations;
 
     std::unique_ptr<sf::Sprite> m_sprite;
     int m_currentFrame;
     float m_frameTimer;
 
     // Son
-    sf::SoundBuffer m_jumpSoundBuffer;
+    std::shared_ptr<sf::SoundBuffer> m_jumpSoundBuffer;
     std::unique_ptr<sf::Sound> m_jumpSound;
 
     // Vie
@@ -148,14 +175,7 @@ private:
     std::vector<sf::Vector2f> m_chargeTrailPositions;  // Traînée de la charge
 
     // Particules d'explosion lors du déclenchement
-    struct ExplosionParticle {
-        sf::Vector2f position;
-        sf::Vector2f velocity;
-        float life;       // 1.0 = neuve, 0.0 = morte
-        float size;
-        sf::Color color;
-    };
-    std::vector<ExplosionParticle> m_explosionParticles;
+    ParticleSystem m_explosionParticles;
 
     static constexpr float CHARGE_PREPARE_DURATION = 0.5f;  // Durée de préparation
     static constexpr float CHARGE_DURATION = 0.4f;          // Durée de la charge
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Générateur PCG32 (O'Neill): 64 bits d'état, quelques instructions par tirage,
+// aucun appel système. Utilisable avec les distributions de <random>, mais les
+// tirages du jeu passent par nextFloat/range/rangeInt: leurs résultats sont les
+// mêmes sur toutes les bibliothèques standard (reproductibilité des simulations).
+class Pcg32 {
+public:
+    using result_type = std::uint32_t;
+
+    explicit Pcg32(std::uint64_t seed = 0x853c49e6748fea9bULL, std::uint64_t sequence = 0xda3e39cb94b95bdbULL) {
+        reseed(seed, sequence);
+    }
+
+    // Deux séquences différentes donnent des suites indépendantes pour une même graine
+    void reseed(std::uint64_t seed, std::uint64_t sequence) {
+        m_state = 0;
+        m_increment = (sequence << 1) | 1u;
+        (*this)();
+        m_state += seed;
+        (*this)();
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return 0xffffffffu; }
+
+    result_type operator()() {
+        std::uint64_t old = m_state;
+        m_state = old * 6364136223846793005ULL + m_increment;
+        std::uint32_t xorShifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+        std::uint32_t rotation = static_cast<std::uint32_t>(old >> 59);
+        return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+    }
+
+    // Flottant dans [0, 1) (24 bits de mantisse)
+    float nextFloat() { return static_cast<float>((*this)() >> 8) * (1.0f / 16777216.0f); }
+
+    // Flottant dans [min, max)
+    float range(float min, float max) { return min + (max - min) * nextFloat(); }
+
+    // Entier dans [min, max] (bornes incluses)
+    int rangeInt(int min, int max) {
+        std::uint64_t span = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min + 1);
+        return min + static_cast<int>((static_cast<std::uint64_t>((*this)()) * span) >> 32);
+    }
+
+private:
+    std::uint64_t m_state;
+    std::uint64_t m_increment;
+};
+
+// Flux aléatoires du jeu: un générateur par sous-système, dérivés d'une seule graine.
+// Un sous-système qui tire plus ou moins de nombres ne décale pas les autres.
+enum class RandomStream {
+    Level,      // Placement des ennemis
+    Ambient,    // Particules et rayons ambiants
+    Enemies,    // Orbites et explosions des ennemis
+    Particles,  // Effets de particules (désintégration, charge, explosions)
+    Count
+};
+
+// Service central des nombres aléatoires. La graine est tirée une seule fois au
+// démarrage (std::random_device); les benchmarks et le mode headless la fixent
+// avec setSeed pour rejouer exactement la même partie.
+class Random {
+public:
+    static Random& getInstance();
+
+    // Réinitialise tous les flux à partir de la graine
+    void setSeed(std::uint64_t seed);
+    std::uint64_t getSeed() const { return m_seed; }
+
+    Pcg32& stream(RandomStream id) { return m_streams[static_cast<std::size_t>(id)]; }
+
+private:
+    Random();
+
+    std::uint64_t m_seed;
+    std::array<Pcg32, static_cast<std::size_t>(RandomStream::Count)> m_streams;
+};
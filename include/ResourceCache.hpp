@@ -0,0 +1,53 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+// Cache central des ressources, indexé par chemin: un fichier n'est chargé qu'une
+// fois, tous les sous-systèmes partagent la même instance (shared_ptr). Le cache
+// garde une référence; evictUnused() libère ce que plus personne n'utilise.
+// Thread principal uniquement (les textures y sont créées et envoyées au GPU).
+class ResourceCache {
+public:
+    static ResourceCache& getInstance();
+
+    // Chargement au premier appel, instance partagée ensuite (nullptr si le fichier est illisible)
+    std::shared_ptr<sf::Texture> getTexture(const std::string& path);
+    std::shared_ptr<sf::Font> getFont(const std::string& path);
+    std::shared_ptr<sf::SoundBuffer> getSoundBuffer(const std::string& path);
+
+    // Ressource déjà construite ailleurs (texture envoyée par AssetLoader, animations du joueur...)
+    template <typename T>
+    std::shared_ptr<T> find(const std::string& key) const {
+        auto it = m_entries.find(key);
+        if (it == m_entries.end() || it->second.type != std::type_index(typeid(T))) {
+            return nullptr;
+        }
+        return std::static_pointer_cast<T>(it->second.resource);
+    }
+
+    template <typename T>
+    void store(const std::string& key, std::shared_ptr<T> resource) {
+        m_entries[key] = Entry{std::move(resource), std::type_index(typeid(T))};
+    }
+
+    // Libère les ressources dont le cache est le seul détenteur; retourne le nombre libéré
+    std::size_t evictUnused();
+    std::size_t getCount() const { return m_entries.size(); }
+
+private:
+    ResourceCache() = default;
+    ResourceCache(const ResourceCache&) = delete;
+    ResourceCache& operator=(const ResourceCache&) = delete;
+
+    struct Entry {
+        std::shared_ptr<void> resource;
+        std::type_index type = std::type_index(typeid(void));
+    };
+
+    std::unordered_map<std::string, Entry> m_entries;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Police en champ de distance signé (SDF) pour les grands titres: les glyphes sont
+// rastérisés une seule fois au chargement (taille de base), convertis en distances
+// au contour et rangés dans un atlas. Un petit shader retrouve le contour net à
+// n'importe quelle taille: pas de rastérisation à la première apparition d'un
+// titre, et un seul atlas pour toutes les tailles (contour compris).
+class SdfFont {
+public:
+    struct Glyph {
+        sf::FloatRect bounds;       // Quad à la taille de base, marge de distance comprise
+        sf::IntRect textureRect;    // Zone dans l'atlas
+        float advance = 0.0f;
+        bool visible = false;       // Les espaces n'ont pas de quad
+    };
+
+    SdfFont();
+
+    // Glyphes ASCII imprimables (32-126) de la police, en gras ou non
+    bool build(const sf::Font& font, bool bold);
+
+    bool isReady() const { return m_ready; }
+    const Glyph& getGlyph(char c) const;
+    float getKerning(char first, char second) const;  // À la taille de base
+    const sf::Texture& getTexture() const { return m_atlas; }
+    // Même atlas seuillé à 0.5 (glyphes nets, sans halo de distance): rendu sans shader
+    const sf::Texture& getAlphaTestTexture() const { return m_alphaTestAtlas; }
+
+    // Prépare le shader pour un texte affiché à characterSize (nullptr si les shaders sont indisponibles)
+    const sf::Shader* prepareShader(unsigned int characterSize, const sf::Color& outlineColor, float outlineThickness) const;
+
+    static constexpr unsigned int BASE_SIZE = 64;   // Taille de rastérisation (pixels)
+    static constexpr int SPREAD = 8;                // Portée du champ de distance autour du contour (texels)
+
+private:
+    static constexpr char FIRST_CHAR = 32;
+    static constexpr char LAST_CHAR = 126;
+
+    static constexpr int CHAR_COUNT = LAST_CHAR - FIRST_CHAR + 1;
+
+    bool m_ready;
+    std::array<Glyph, CHAR_COUNT> m_glyphs;
+    std::vector<float> m_kerning;  // CHAR_COUNT x CHAR_COUNT, précalculé (la police n'est plus consultée)
+    sf::Texture m_atlas;
+    sf::Texture m_alphaTestAtlas;
+    std::unique_ptr<sf::Shader> m_shader;
+};
+
+// Texte dessiné depuis un SdfFont (une ligne). La géométrie n'est reconstruite que
+// lorsque le texte ou sa taille changent.
+class SdfText : public sf::Drawable, public sf::Transformable {
+public:
+    SdfText(const SdfFont& font, const std::string& string, unsigned int characterSize);
+
+    void setString(const std::string& string);
+    void setCharacterSize(unsigned int characterSize);
+    void setFillColor(const sf::Color& color);
+    void setOutlineColor(const sf::Color& color) { m_outlineColor = color; }
+    void setOutlineThickness(float thickness) { m_outlineThickness = thickness; }
+
+    sf::FloatRect getLocalBounds() const;  // Contour compris, comme sf::Text
+
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+    void rebuild();
+
+    const SdfFont* m_font;
+    std::string m_string;
+    unsigned int m_characterSize;
+    sf::Color m_fillColor;
+    sf::Color m_outlineColor;
+    float m_outlineThickness;
+    sf::VertexArray m_vertices;
+    sf::FloatRect m_bounds;  // Glyphes seuls (sans contour)
+};
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Level.hpp"
+#include "Player.hpp"
+#include <memory>
+#include <string>
+
+// Simulation du gameplay sans fenêtre ni contexte OpenGL: Player::update,
+// Level::update et les collisions tournent à pas fixe, sans textures ni sons.
+// Sert aux tests en CI et à mesurer le débit de ticks indépendamment du rendu.
+class Simulation {
+public:
+    struct Result {
+        int ticks = 0;              // Ticks réellement simulés
+        double elapsedSeconds = 0.0;
+        double ticksPerSecond = 0.0;
+        sf::Vector2f finalPosition;
+        int health = 0;
+        int falls = 0;              // Chutes hors du niveau (le joueur réapparaît au portail)
+        bool finished = false;      // Portail de sortie atteint
+        bool dead = false;          // Vie à 0
+    };
+
+    explicit Simulation(CharacterType characterType = CharacterType::Wizard);
+
+    // Charge un niveau (0 = prologue) et place le joueur au portail d'entrée, comme Game::loadLevel
+    bool loadLevel(int levelNumber);
+
+    // Entrées scriptées
+    void setKey(sf::Keyboard::Key key, bool isPressed);
+
+    // Un tick à pas fixe (retourne false si la partie est terminée: sortie atteinte ou mort)
+    bool step();
+    bool isOver() const { return m_finished || m_player->isDead(); }  // Plus aucun tick ne sera simulé
+
+    // Enchaîne jusqu'à tickCount ticks (arrêt anticipé si la partie est terminée)
+    Result run(int tickCount);
+
+    Player& getPlayer() { return *m_player; }
+    Level& getLevel() { return *m_level; }
+
+    static const sf::Time TimeStep;
+
+private:
+    void respawn();
+
+    std::unique_ptr<Level> m_level;
+    std::unique_ptr<Player> m_player;
+    sf::Vector2f m_respawnPosition;
+
+    int m_falls;
+    bool m_finished;
+};
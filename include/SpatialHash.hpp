@@ -0,0 +1,51 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// Grille uniforme de partitionnement spatial: chaque élément (identifiant entier)
+// est rangé dans toutes les cellules couvertes par ses bounds. Une requête ne
+// visite que les cellules de la zone demandée, son coût dépend du nombre
+// d'éléments proches et non du total.
+//
+// La grille couvre la zone du monde donnée à reset(); les coordonnées hors de
+// cette zone sont ramenées dans les cellules du bord, les éléments sortis du
+// niveau restent donc trouvables.
+class SpatialHash {
+public:
+    explicit SpatialHash(float cellSize = 256.0f);
+
+    // Redimensionne la grille sur la zone du monde et retire tous les éléments
+    void reset(const sf::FloatRect& worldBounds);
+
+    void insert(int id, const sf::FloatRect& bounds);
+    void remove(int id, const sf::FloatRect& bounds);
+    // Déplace un élément (rien à faire s'il couvre toujours les mêmes cellules)
+    void update(int id, const sf::FloatRect& oldBounds, const sf::FloatRect& newBounds);
+
+    // Identifiants des éléments rangés dans les cellules touchées par la zone,
+    // sans doublons, par identifiant croissant. Le résultat est large: à filtrer
+    // par un test d'intersection exact.
+    void query(const sf::FloatRect& area, std::vector<int>& results);
+
+    float getCellSize() const { return m_cellSize; }
+
+private:
+    struct CellRange {
+        int left, top, right, bottom;  // Cellules couvertes (bornes incluses)
+    };
+
+    CellRange getCellRange(const sf::FloatRect& bounds) const;
+    std::vector<int>& cellAt(int x, int y) { return m_cells[static_cast<std::size_t>(y) * m_columns + x]; }
+
+    float m_cellSize;
+    sf::Vector2f m_origin;
+    int m_columns;
+    int m_rows;
+    std::vector<std::vector<int>> m_cells;  // Ligne par ligne (index = y * m_columns + x)
+
+    // Dernière requête ayant retourné chaque identifiant (dédoublonnage des grands éléments)
+    std::vector<std::uint32_t> m_queryStamps;
+    std::uint32_t m_queryCounter;
+};
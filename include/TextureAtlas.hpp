@@ -0,0 +1,53 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <string>
+#include <memory>
+#include "CookedAssets.hpp"
+
+// Atlas de textures construit au chargement: les frames d'animation sont
+// empaquetées (par étagères) dans une ou quelques grandes textures, et une
+// animation se joue en changeant uniquement le rectangle de texture du sprite.
+class TextureAtlas {
+public:
+    struct Frame {
+        std::size_t page = 0;   // Index de la texture qui contient la frame
+        sf::IntRect rect;       // Zone de la frame dans cette texture
+        float scale = 1.0f;     // Taille dans l'atlas / taille de l'image source (< 1 si l'asset est cuit)
+    };
+
+    TextureAtlas();
+
+    // Ajoute une image (ou une zone de l'image) à empaqueter. Retourne l'index de la frame, -1 en cas d'échec.
+    // Le rectangle de la frame n'est valide qu'après build().
+    int addImage(const sf::Image& image, const sf::IntRect& area = {});
+    int addFile(const std::string& filepath);  // Charge la version cuite si elle existe (voir CookedAssets)
+    int addDecoded(const sf::Image& image, const CookedAssets::Entry& source);  // Image décodée par AssetLoader
+
+    // Empaquette les images ajoutées depuis le dernier build() dans de nouvelles pages et les envoie au GPU
+    bool build();
+
+    std::size_t getFrameCount() const { return m_frames.size(); }
+    const Frame& getFrame(int index) const { return m_frames[index]; }
+
+    std::size_t getPageCount() const { return m_pages.size(); }
+    const sf::Texture& getPageTexture(std::size_t page) const { return *m_pages[page]; }
+
+    void setSmooth(bool smooth);
+
+private:
+    struct PendingFrame {
+        int frameIndex;
+        sf::Image image;
+    };
+
+    std::vector<Frame> m_frames;
+    std::vector<PendingFrame> m_pending;
+    std::vector<std::unique_ptr<sf::Texture>> m_pages;  // unique_ptr: adresses stables pour les sprites
+    bool m_smooth;
+    bool m_mipmaps;  // Demandé par au moins une image cuite des pages en attente
+
+    static constexpr unsigned int MAX_PAGE_SIZE = 4096;
+    static constexpr unsigned int PADDING = 2;  // Espace entre les frames (évite les débordements au filtrage)
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+class Tilemap;
+
+// Rectangle de collision d'un personnage, positionné par son coin haut-gauche.
+// Les murs arrêtent la colonne centrale du corps (le sprite a des marges
+// transparentes), le sol et les plafonds arrêtent toute sa largeur.
+struct CollisionBody {
+    sf::Vector2f size;
+    float feetOffset;  // Distance entre les pieds et le bas du rectangle
+};
+
+// Résultat d'un déplacement balayé
+struct SweepResult {
+    sf::Vector2f position;       // Position finale (coin haut-gauche)
+    float timeOfImpactX = 1.0f;  // Fraction du déplacement horizontal effectuée (1 = aucun contact)
+    float timeOfImpactY = 1.0f;  // Fraction du déplacement vertical effectuée
+    bool hitWall = false;        // Déplacement horizontal arrêté par une tile solide
+    bool hitCeiling = false;     // Montée arrêtée par un plafond
+    bool grounded = false;       // Pieds posés sur un sol à la fin du déplacement
+};
+
+// Collisions continues (swept AABB) contre la grille de tiles.
+//
+// Le déplacement est résolu axe par axe, X puis Y: les colonnes (ou lignes) de
+// tiles traversées sont parcourues dans l'ordre du mouvement et le corps s'arrête
+// sur la première face touchée. Seul l'axe bloqué est arrêté, le corps glisse sur
+// l'autre. Aucune tile ne peut être traversée, quelle que soit la vitesse ou la
+// durée du pas. Les faces viennent des collision boxes précalculées (offsets compris):
+//   - horizontalement, toute tile solide bloque (murs, blocs);
+//   - en descendant, les tiles CELL_GROUND portent le corps (à la profondeur d'herbe);
+//   - en montant, seules les tiles CELL_CEILING bloquent (les plateformes se traversent).
+// Un corps qui commence un déplacement à l'intérieur d'une tile peut toujours en sortir.
+namespace TileCollision {
+    // Distance (pixels) sous laquelle des pieds au-dessus d'un sol sont considérés posés
+    constexpr float GROUND_SNAP = 2.0f;
+
+    SweepResult move(const Tilemap& tilemap, const CollisionBody& body,
+                     const sf::Vector2f& start, const sf::Vector2f& displacement);
+}
@@ -1,10 +1,10 @@
 #pragma once
 
 #include <string>
-#include <map>
-#include <memory>
+#include <vector>
+#include <cstdint>
 
-enum class CollisionType {
+enum class CollisionType : std::uint8_t {
     NONE,
     SOLID,
     EMPTY,
@@ -39,6 +39,7 @@ struct CollisionBox {
     CollisionBox() : left(0), top(0), right(0), bottom(0) {}
 };
 
+// Enregistrement complet d'une tile tel que lu dans la configuration
 struct TileProperties {
     std::string description;
     CollisionType collisionType;
@@ -55,20 +56,46 @@ struct TileProperties {
     {}
 };
 
+// Partie "chaude" des propriétés: tout ce que lisent les collisions, sans chaînes
+struct TileCollisionData {
+    CollisionType collisionType = CollisionType::NONE;
+    bool solid = false;    // Ni NONE ni EMPTY
+    bool defined = false;  // Présente dans la configuration
+    float grassDepth = 0.0f;
+    CollisionBox collisionBox;
+    int damage = 0;
+};
+
+// Partie "froide": textes pour l'éditeur et le debug
+struct TileInfo {
+    std::string description;
+    std::string portalDestination;
+    std::string notes;
+};
+
 class TilePropertiesManager {
 public:
     static TilePropertiesManager& getInstance();
 
     bool loadFromFile(const std::string& filepath);
-    const TileProperties* getTileProperties(int tileId) const;
+
+    // Table dense indexée par id de tile: un accès direct, ids inconnus = pas de collision
+    const TileCollisionData& getCollisionData(int tileId) const {
+        if (tileId < 0 || static_cast<std::size_t>(tileId) >= m_collisionData.size()) return s_noCollision;
+        return m_collisionData[tileId];
+    }
+    const TileInfo* getTileInfo(int tileId) const;  // nullptr si l'id n'est pas configuré
 
     // Helpers pour les collisions
-    bool isSolid(int tileId) const;
-    bool isPlatform(int tileId) const;
-    bool isSlope(int tileId) const;
-    CollisionType getCollisionType(int tileId) const;
-    float getGrassDepth(int tileId) const;
-    CollisionBox getCollisionBox(int tileId) const;
+    bool isSolid(int tileId) const { return getCollisionData(tileId).solid; }
+    bool isPlatform(int tileId) const { return getCollisionData(tileId).collisionType == CollisionType::PLATFORM; }
+    bool isSlope(int tileId) const {
+        CollisionType type = getCollisionData(tileId).collisionType;
+        return type == CollisionType::SLOPE_LEFT || type == CollisionType::SLOPE_RIGHT;
+    }
+    CollisionType getCollisionType(int tileId) const { return getCollisionData(tileId).collisionType; }
+    float getGrassDepth(int tileId) const { return getCollisionData(tileId).grassDepth; }
+    const CollisionBox& getCollisionBox(int tileId) const { return getCollisionData(tileId).collisionBox; }
 
 private:
     TilePropertiesManager() = default;
@@ -78,5 +105,8 @@ private:
 
     CollisionType stringToCollisionType(const std::string& str) const;
 
-    std::map<int, TileProperties> m_properties;
+    std::vector<TileCollisionData> m_collisionData;  // Index = id de tile
+    std::vector<TileInfo> m_tileInfo;                // Index = id de tile
+
+    static const TileCollisionData s_noCollision;
 };
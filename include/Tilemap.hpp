@@ -3,28 +3,86 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include "CookedAssets.hpp"
 #include "TileProperties.hpp"
 
 class Tilemap {
 public:
+    // Bits de collision précalculés par cellule (voir getCellFlags)
+    enum CellFlags : std::uint8_t {
+        CELL_SOLID   = 1 << 0,  // Tile avec collision (ni vide ni "empty")
+        CELL_WALL    = 1 << 1,  // wall-left / wall-right: bloque sur les côtés, pas un sol
+        CELL_CEILING = 1 << 2,  // ceiling: bloque par le haut
+        CELL_GROUND  = 1 << 3   // Solide et pas un mur: le joueur peut s'y poser
+    };
+
+    // Backend de rendu des tiles
+    enum class RenderMode {
+        Chunks,  // Géométrie statique par chunks (un VertexBuffer par chunk visible)
+        Shader   // Texture d'indices + fragment shader (un seul quad pour toute la vue)
+    };
+
     Tilemap(int tileSize = 32);
 
+    // Mode sans rendu (simulation headless): pas de texture ni de géométrie GPU,
+    // seules les données de tiles et de collision sont conservées
+    void setHeadless(bool headless) { m_headless = headless; }
+    bool isHeadless() const { return m_headless; }
+
     bool loadFromFile(const std::string& tilesetPath);
+    // Tileset déjà chargé (AssetLoader, ResourceCache); cooked donne son échelle et ses mipmaps
+    void setTileset(std::shared_ptr<sf::Texture> tileset, const CookedAssets::Entry& cooked);
+
+    // Reprend le tileset déjà chargé d'une autre tilemap (texture partagée, rien n'est relu)
+    void shareTileset(const Tilemap& other);
+
+    // Préparation hors du thread du rendu (préchargement d'un niveau): la géométrie des
+    // chunks est construite en mémoire seulement, uploadDeferred() l'envoie ensuite au GPU
+    void setDeferredUpload(bool deferred) { m_deferredUpload = deferred; }
+    void uploadDeferred();
     void loadFromData(const std::vector<std::vector<int>>& data, int tilesetWidth);
+    // Grille ligne par ligne (index = y * width + x), telle que lue depuis un fichier de niveau
+    void loadFromData(const std::vector<std::int16_t>& tiles, int width, int height, int tilesetWidth);
+
+    // Recalcule les données de collision de chaque cellule (après un rechargement des propriétés)
+    void bakeCollision();
 
     void render(sf::RenderWindow& window);
 
-    // Collision detection
-    bool isSolid(int x, int y) const;
+    // Changement de backend (retourne false si le backend n'est pas supporté)
+    bool setRenderMode(RenderMode mode);
+    RenderMode getRenderMode() const { return m_renderMode; }
+
+    // Reconstruit la géométrie de tous les chunks (en headless: copie CPU seulement, sans envoi au GPU)
+    void updateVertices();
+
+    // Modifier une tile (reconstruit un seul chunk, ou un seul texel en mode Shader)
+    void setTile(int x, int y, int tileId);
+
+    // Collision detection (hors limites = vide)
+    std::uint8_t getCellFlags(int x, int y) const {
+        if (x < 0 || x >= m_width || y < 0 || y >= m_height) return 0;
+        return m_cellFlags[static_cast<std::size_t>(y) * m_width + x];
+    }
+    // Ligne de bits de collision (m_width cellules), pour les parcours linéaires
+    const std::uint8_t* getCellFlagsRow(int y) const { return m_cellFlags.data() + static_cast<std::size_t>(y) * m_width; }
+
+    bool isSolid(int x, int y) const { return (getCellFlags(x, y) & CELL_SOLID) != 0; }
     sf::FloatRect getTileBounds(int x, int y) const;
     sf::FloatRect getTileCollisionBounds(int x, int y) const;  // Bounds ajustés avec collisionBox
 
     // Tile properties access
     int getTileId(int x, int y) const;
-    const TileProperties* getTileProperties(int x, int y) const;
+    const TileInfo* getTileInfo(int x, int y) const;  // Description / notes (éditeur, debug)
     CollisionType getCollisionType(int x, int y) const;
     float getGrassDepth(int x, int y) const;
 
+    // Statistiques du dernier rendu (chunks dessinés / chunks non vides hors de la vue)
+    int getDrawnChunkCount() const { return m_drawnChunks; }
+    int getCulledChunkCount() const { return m_culledChunks; }
+    int getNonEmptyChunkCount() const { return m_nonEmptyChunks; }  // 0 en mode Shader (pas de géométrie)
+
     int getTileSize() const { return m_tileSize; }
     int getWidth() const { return m_width; }
     int getHeight() const { return m_height; }
@@ -33,14 +91,58 @@ private:
     // Debug constants
     static constexpr bool SHOW_DEBUG_TILE_OUTLINE = false; // Mettre à true pour afficher les contours rouges des tuiles
 
+    // Rendu par chunks
+    static constexpr int CHUNK_SIZE = 16;             // Chaque chunk couvre 16x16 tiles
+    static constexpr int TILESET_SECTION_SIZE = 256;  // Taille d'une section dans le tileset source (pixels)
+
+    // Géométrie statique d'un chunk: un seul draw call par chunk visible
+    struct Chunk {
+        std::vector<sf::Vertex> vertices;  // Copie CPU (utilisée si les VertexBuffer ne sont pas disponibles)
+        sf::VertexBuffer buffer{sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static};
+        bool hasBuffer = false;
+    };
+
     int m_tileSize;
     int m_width;
     int m_height;
     int m_tilesetWidthInTiles;  // Nombre de tiles par ligne dans le tileset
+    int m_sectionSize;          // Taille d'une section dans la texture chargée (réduite si le tileset est cuit)
+    bool m_headless;
+    bool m_deferredUpload;  // Pas d'envoi au GPU (thread de chargement)
+
+    // Données de surface d'une cellule solide (lues seulement après un test des bits de collision)
+    struct CellSurface {
+        CollisionType collisionType = CollisionType::NONE;
+        float grassDepth = 0.0f;  // Pourcentage (0-100)
+        CollisionBox collisionBox;
+    };
 
     std::shared_ptr<sf::Texture> m_tileset;
-    std::vector<std::vector<int>> m_tiles;
-    sf::VertexArray m_vertices;  // Utiliser VertexArray au lieu de vector<Vertex>
+    std::vector<std::int16_t> m_tiles;       // Ligne par ligne (index = y * m_width + x), -1 = vide
+    std::vector<std::uint8_t> m_cellFlags;   // CellFlags par cellule, parallèle à m_tiles
+    std::vector<CellSurface> m_cellSurfaces; // Surface par cellule, parallèle à m_tiles
 
-    void updateVertices();
+    int m_chunksX;
+    int m_chunksY;
+    std::vector<Chunk> m_chunks;
+    int m_nonEmptyChunks;
+    int m_drawnChunks;
+    int m_culledChunks;
+
+    // Backend shader
+    RenderMode m_renderMode;
+    sf::Texture m_indexTexture;  // 1 texel par tile: (id + 1) sur R (poids faible) et G (poids fort)
+    sf::Shader m_tileShader;
+    bool m_shaderLoaded;
+    bool m_indexTextureReady;
+
+    std::size_t cellIndex(int x, int y) const { return static_cast<std::size_t>(y) * m_width + x; }
+    static std::uint8_t describeTile(int tileId, CellSurface& surface);  // Bits de collision + surface d'un id
+
+    void buildChunk(int chunkX, int chunkY);
+    void uploadChunk(Chunk& chunk);    // Envoie la géométrie d'un chunk dans son VertexBuffer
+    bool updateIndexTexture();         // Reconstruit la texture d'indices
+
+    void renderChunks(sf::RenderWindow& window, const sf::FloatRect& visible);
+    void renderWithShader(sf::RenderWindow& window, const sf::FloatRect& visible);
 };
@@ -0,0 +1,119 @@
+#include "AmbientParticles.hpp"
+#include "FastMath.hpp"
+
+const sf::Color AmbientParticles::PALETTE[4] = {
+    sf::Color(255, 255, 240),  // Blanc chaud
+    sf::Color(255, 248, 220),  // Beige clair
+    sf::Color(245, 245, 220),  // Beige
+    sf::Color(255, 250, 205)   // Jaune pâle (pollen)
+};
+
+void AmbientParticles::clear() {
+    baseX.clear();
+    baseY.clear();
+    x.clear();
+    y.clear();
+    size.clear();
+    alpha.clear();
+    phase.clear();
+    speed.clear();
+    amplitude.clear();
+    drift.clear();
+    seed.clear();
+    colorIndex.clear();
+}
+
+void AmbientParticles::generate(int particleCount, float levelWidth, float levelHeight, Pcg32& rng) {
+    for (int i = 0; i < particleCount; ++i) {
+        float px = rng.range(0.0f, levelWidth);
+        float py = rng.range(0.0f, levelHeight);
+        baseX.push_back(px);
+        baseY.push_back(py);
+        x.push_back(px);
+        y.push_back(py);
+        size.push_back(rng.range(1.5f, 4.0f));
+        alpha.push_back(rng.range(15.0f, 40.0f));  // Très subtil
+        phase.push_back(rng.range(0.0f, FastMath::TWO_PI));
+        speed.push_back(rng.range(0.3f, 0.8f));
+        amplitude.push_back(rng.range(8.0f, 25.0f));
+        drift.push_back(rng.range(2.0f, 8.0f));
+        seed.push_back(rng());
+        colorIndex.push_back(static_cast<std::uint8_t>(rng.rangeInt(0, 3)));
+    }
+}
+
+void AmbientParticles::update(float dt, float levelWidth, float levelHeight) {
+    const std::size_t n = count();
+    const float respawnY = levelHeight + 50.0f;
+    const float seedToX = levelWidth / 16777216.0f;  // 24 bits du générateur -> [0, largeur)
+
+    float* px = x.data();
+    float* py = y.data();
+    float* pbaseX = baseX.data();
+    float* pbaseY = baseY.data();
+    float* pphase = phase.data();
+    std::uint32_t* pseed = seed.data();
+    const float* pspeed = speed.data();
+    const float* pamplitude = amplitude.data();
+    const float* pdrift = drift.data();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        // Mouvement oscillatoire (flottement), phase gardée entre 0 et 2π
+        float p = pphase[i] + pspeed[i] * dt;
+        p = p > FastMath::TWO_PI ? p - FastMath::TWO_PI : p;
+        pphase[i] = p;
+
+        // Calculer le décalage oscillatoire
+        float offsetX = FastMath::sin(p) * pamplitude[i];
+        float offsetY = FastMath::cos(p * 0.7f) * pamplitude[i] * 0.5f;
+
+        // Dérive lente vers le haut; sortie du niveau: réapparition en bas à un X aléatoire
+        float by = pbaseY[i] - pdrift[i] * dt;
+        bool wrapped = by < -50.0f;
+        std::uint32_t s = wrapped ? pseed[i] * 1664525u + 1013904223u : pseed[i];
+        pseed[i] = s;
+        float bx = wrapped ? static_cast<float>(static_cast<std::int32_t>(s >> 8)) * seedToX : pbaseX[i];
+        by = wrapped ? respawnY : by;
+        pbaseX[i] = bx;
+        pbaseY[i] = by;
+
+        // Position finale
+        px[i] = bx + offsetX;
+        py[i] = by + offsetY;
+    }
+}
+
+void LightRays::clear() {
+    x.clear();
+    y.clear();
+    width.clear();
+    height.clear();
+    alpha.clear();
+    flickerPhase.clear();
+    flickerSpeed.clear();
+    angle.clear();
+}
+
+void LightRays::generate(int rayCount, float levelWidth, float levelHeight, Pcg32& rng) {
+    for (int i = 0; i < rayCount; ++i) {
+        x.push_back(rng.range(0.0f, levelWidth));
+        y.push_back(rng.range(0.0f, levelHeight) * 0.3f);  // Plutôt vers le haut
+        width.push_back(rng.range(30.0f, 80.0f));
+        height.push_back(rng.range(150.0f, 400.0f));
+        alpha.push_back(rng.range(8.0f, 18.0f));  // Très très subtil
+        flickerPhase.push_back(rng.range(0.0f, FastMath::TWO_PI));
+        flickerSpeed.push_back(rng.range(0.2f, 0.5f));
+        angle.push_back(rng.range(-15.0f, 15.0f));
+    }
+}
+
+void LightRays::update(float dt) {
+    const std::size_t n = count();
+    float* phase = flickerPhase.data();
+    const float* speed = flickerSpeed.data();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        float p = phase[i] + speed[i] * dt;
+        phase[i] = p > FastMath::TWO_PI ? p - FastMath::TWO_PI : p;
+    }
+}
@@ -13,23 +13,31 @@ AnimatedSprite::AnimatedSprite()
 }
 
 bool AnimatedSprite::loadAnimation(const std::string& directory, const std::string& prefix, int frameCount) {
-    m_textures.clear();
-    m_textures.reserve(frameCount);
+    m_sprite.reset();  // Le sprite référence les pages de l'ancien atlas
+    m_atlas = TextureAtlas();
+    m_frames.clear();
+    m_frames.reserve(frameCount);
 
     for (int i = 0; i < frameCount; ++i) {
         // Format: "Chara - BlueIdle00000.png"
         std::string filename = directory + "/" + prefix + std::to_string(i).insert(0, 5 - std::to_string(i).length(), '0') + ".png";
 
-        auto texture = std::make_shared<sf::Texture>();
-        if (!texture->loadFromFile(filename)) {
+        int frameIndex = m_atlas.addFile(filename);
+        if (frameIndex < 0) {
             std::cerr << "Failed to load texture: " << filename << std::endl;
             return false;
         }
-        m_textures.push_back(texture);
+        m_frames.push_back(frameIndex);
     }
 
-    if (!m_textures.empty()) {
-        m_sprite = std::make_unique<sf::Sprite>(*m_textures[0]);
+    // Toutes les frames dans une ou quelques textures: l'animation ne change que le rect
+    if (!m_atlas.build()) {
+        m_frames.clear();
+    }
+
+    if (!m_frames.empty()) {
+        m_sprite = std::make_unique<sf::Sprite>(m_atlas.getPageTexture(0));
+        applyFrame(0);
         // PAS DE SCALE - affiche en taille réelle (512x512)
         // m_sprite->setScale(sf::Vector2f(0.2f, 0.2f));
 
@@ -39,11 +47,22 @@ bool AnimatedSprite::loadAnimation(const std::string& directory, const std::stri
         std::cout << "Sprite will be rendered at FULL SIZE (no scale)" << std::endl;
     }
 
-    return !m_textures.empty();
+    return !m_frames.empty();
+}
+
+void AnimatedSprite::applyFrame(int frame) {
+    const TextureAtlas::Frame& atlasFrame = m_atlas.getFrame(m_frames[frame]);
+    const sf::Texture& page = m_atlas.getPageTexture(atlasFrame.page);
+
+    // Ne changer de texture que si la frame est sur une autre page de l'atlas
+    if (&m_sprite->getTexture() != &page) {
+        m_sprite->setTexture(page, false);
+    }
+    m_sprite->setTextureRect(atlasFrame.rect);
 }
 
 void AnimatedSprite::update(sf::Time deltaTime) {
-    if (!m_isPlaying || m_textures.empty() || !m_sprite) {
+    if (!m_isPlaying || m_frames.empty() || !m_sprite) {
         return;
     }
 
@@ -53,24 +72,16 @@ void AnimatedSprite::update(sf::Time deltaTime) {
         m_timeSinceLastFrame -= m_frameTime;
         m_currentFrame++;
 
-        if (m_currentFrame >= static_cast<int>(m_textures.size())) {
+        if (m_currentFrame >= static_cast<int>(m_frames.size())) {
             if (m_loop) {
                 m_currentFrame = 0;
             } else {
-                m_currentFrame = static_cast<int>(m_textures.size()) - 1;
+                m_currentFrame = static_cast<int>(m_frames.size()) - 1;
                 m_isPlaying = false;
             }
         }
 
-        // Save current transform properties before changing texture
-        sf::Vector2f currentScale = m_sprite->getScale();
-        sf::Vector2f currentPosition = m_sprite->getPosition();
-
-        m_sprite->setTexture(*m_textures[m_currentFrame]);
-
-        // Restore transform properties
-        m_sprite->setScale(currentScale);
-        m_sprite->setPosition(currentPosition);
+        applyFrame(m_currentFrame);
     }
 }
 
@@ -91,16 +102,8 @@ void AnimatedSprite::pause() {
 void AnimatedSprite::reset() {
     m_currentFrame = 0;
     m_timeSinceLastFrame = 0.0f;
-    if (!m_textures.empty() && m_sprite) {
-        // Save current transform properties
-        sf::Vector2f currentScale = m_sprite->getScale();
-        sf::Vector2f currentPosition = m_sprite->getPosition();
-
-        m_sprite->setTexture(*m_textures[0]);
-
-        // Restore transform properties
-        m_sprite->setScale(currentScale);
-        m_sprite->setPosition(currentPosition);
+    if (!m_frames.empty() && m_sprite) {
+        applyFrame(0);
     }
 }
 
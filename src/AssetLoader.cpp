@@ -0,0 +1,165 @@
+#include "AssetLoader.hpp"
+#include "ResourceCache.hpp"
+#include <algorithm>
+#include <iostream>
+
+AssetLoader::AssetLoader(unsigned int threadCount)
+    : m_stopping(false)
+    , m_requested(0)
+    , m_completed(0)
+{
+    // Le thread principal ne fait qu'afficher la progression pendant le chargement
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    m_workers.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        m_workers.emplace_back(&AssetLoader::workerLoop, this);
+    }
+}
+
+AssetLoader::~AssetLoader() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+        m_jobs.clear();
+    }
+    m_jobAvailable.notify_all();
+
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void AssetLoader::loadImage(const std::string& filepath, ImageCallback onLoaded, bool useCooked) {
+    CookedAssets::Entry source;
+    if (useCooked) {
+        source = CookedAssets::getInstance().resolve(filepath);
+    } else {
+        source.path = filepath;
+    }
+
+    submit(std::move(source), [onLoaded = std::move(onLoaded)](sf::Image* image, const CookedAssets::Entry& decoded) {
+        if (image) {
+            onLoaded(*image, decoded);
+        } else {
+            std::cerr << "✗ Failed to load image: " << decoded.path << std::endl;
+        }
+    });
+}
+
+void AssetLoader::loadTexture(const std::string& filepath, TextureCallback onLoaded, bool useCooked) {
+    CookedAssets::Entry source;
+    if (useCooked) {
+        source = CookedAssets::getInstance().resolve(filepath);
+    } else {
+        source.path = filepath;
+    }
+
+    // Déjà chargée (par un autre sous-système ou un chargement précédent)
+    if (auto texture = ResourceCache::getInstance().find<sf::Texture>(source.path)) {
+        m_ready.push_back([texture, source, onLoaded = std::move(onLoaded)]() { onLoaded(texture, source); });
+        ++m_requested;
+        return;
+    }
+
+    // Déjà en cours de décodage: attendre le même résultat
+    auto pending = m_pendingTextures.find(source.path);
+    if (pending != m_pendingTextures.end()) {
+        pending->second.push_back(std::move(onLoaded));
+        ++m_requested;
+        return;
+    }
+
+    m_pendingTextures[source.path].push_back(std::move(onLoaded));
+    submit(source, [this](sf::Image* image, const CookedAssets::Entry& decoded) {
+        auto pendingIt = m_pendingTextures.find(decoded.path);
+        std::vector<TextureCallback> waiting = std::move(pendingIt->second);
+        m_pendingTextures.erase(pendingIt);
+        m_completed += waiting.size() - 1;  // Le premier est compté par pump()
+
+        auto texture = std::make_shared<sf::Texture>();
+        if (!image || !texture->loadFromImage(*image)) {
+            std::cerr << "✗ Failed to load texture: " << decoded.path << std::endl;
+            return;
+        }
+        ResourceCache::getInstance().store(decoded.path, texture);
+
+        for (const TextureCallback& callback : waiting) {
+            callback(texture, decoded);
+        }
+    });
+}
+
+void AssetLoader::submit(CookedAssets::Entry source, DecodeCallback onDecoded) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back({std::move(source), std::move(onDecoded)});
+    }
+    ++m_requested;
+    m_jobAvailable.notify_one();
+}
+
+void AssetLoader::workerLoop() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobAvailable.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+            if (m_stopping) return;
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        // Décodage hors verrou (sf::Image n'utilise pas le contexte OpenGL)
+        Result result{std::move(job.source), std::move(job.onDecoded), sf::Image(), false};
+        result.ok = result.image.loadFromFile(result.source.path);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_results.push_back(std::move(result));
+        }
+        m_resultAvailable.notify_one();
+    }
+}
+
+std::size_t AssetLoader::pump(std::size_t maxCompletions) {
+    std::size_t completions = 0;
+
+    // Textures déjà en cache: rien à attendre
+    while (!m_ready.empty() && completions < maxCompletions) {
+        std::function<void()> deliver = std::move(m_ready.front());
+        m_ready.pop_front();
+        deliver();
+        ++m_completed;
+        ++completions;
+    }
+
+    std::vector<Result> ready;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        while (!m_results.empty() && completions + ready.size() < maxCompletions) {
+            ready.push_back(std::move(m_results.front()));
+            m_results.pop_front();
+        }
+    }
+
+    // Callbacks hors verrou: ils envoient les textures au GPU (thread principal uniquement)
+    for (Result& result : ready) {
+        result.onDecoded(result.ok ? &result.image : nullptr, result.source);
+        ++m_completed;
+        ++completions;
+    }
+    return completions;
+}
+
+void AssetLoader::finish() {
+    while (!isDone()) {
+        if (m_ready.empty()) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_resultAvailable.wait(lock, [this] { return !m_results.empty(); });
+        }
+        pump(m_requested - m_completed);
+    }
+}
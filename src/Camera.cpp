@@ -11,6 +11,21 @@ Camera::Camera(float viewWidth, float viewHeight)
 {
     m_view.setSize(sf::Vector2f(viewWidth, viewHeight));
     m_view.setCenter(sf::Vector2f(viewWidth / 2.0f, viewHeight / 2.0f));
+    saveInterpolationState();
+}
+
+sf::View Camera::getView(float interpolation) const {
+    sf::View view = m_view;
+    view.setCenter(m_interpolationCenter + (m_view.getCenter() - m_interpolationCenter) * interpolation);
+
+    float rotation = m_view.getRotation().wrapSigned().asDegrees();
+    view.setRotation(sf::degrees(m_interpolationRotation + (rotation - m_interpolationRotation) * interpolation));
+    return view;
+}
+
+void Camera::saveInterpolationState() {
+    m_interpolationCenter = m_view.getCenter();
+    m_interpolationRotation = m_view.getRotation().wrapSigned().asDegrees();  // Breathing: quelques dixièmes de degré autour de 0
 }
 
 void Camera::update(const sf::Vector2f& targetPosition, sf::Time deltaTime, bool playerIsMoving) {
@@ -71,7 +86,19 @@ void Camera::update(const sf::Vector2f& targetPosition, sf::Time deltaTime, bool
 }
 
 void Camera::setPosition(const sf::Vector2f& position) {
+    // Téléportation: pas d'interpolation depuis l'ancienne position
     m_view.setCenter(position);
+    saveInterpolationState();
+}
+
+sf::FloatRect Camera::getVisibleArea(float margin) const {
+    // Projeter les coins de la vue dans le monde (la rotation du breathing est incluse)
+    sf::FloatRect area = m_view.getInverseTransform().transformRect(
+        sf::FloatRect(sf::Vector2f(-1.0f, -1.0f), sf::Vector2f(2.0f, 2.0f)));
+
+    area.position -= sf::Vector2f(margin, margin);
+    area.size += sf::Vector2f(margin * 2.0f, margin * 2.0f);
+    return area;
 }
 
 void Camera::setBounds(float left, float top, float width, float height) {
@@ -1,4 +1,6 @@
 #include "CharacterSelection.hpp"
+#include "AssetLoader.hpp"
+#include "ResourceCache.hpp"
 #include <iostream>
 
 CharacterSelection::CharacterSelection()
@@ -6,21 +8,24 @@ CharacterSelection::CharacterSelection()
     , m_selectionMade(false)
 {
     // Charger la police
-    if (!m_font.openFromFile("assets/Arial.ttf")) {
+    m_font = ResourceCache::getInstance().getFont("assets/Arial.ttf");
+    if (!m_font) {
         std::cerr << "✗ Failed to load font for character selection" << std::endl;
+        m_font = std::make_shared<sf::Font>();
     }
+}
 
-    // Charger les previews des personnages
-    m_wizardPreview = std::make_unique<sf::Texture>();
-    if (!m_wizardPreview->loadFromFile("assets/tiles/BlueWizard/2BlueWizardIdle/Chara - BlueIdle00000.png")) {
-        std::cerr << "✗ Failed to load wizard preview" << std::endl;
-    }
-
-    m_goatPreview = std::make_unique<sf::Texture>();
-    if (!m_goatPreview->loadFromFile("assets/tiles/Chevre/chevre-face.png")) {
-        std::cerr << "✗ Failed to load goat preview" << std::endl;
-        m_goatPreview.reset();
-    }
+void CharacterSelection::requestAssets(AssetLoader& loader) {
+    // Charger les previews des personnages (affichées dès qu'elles sont prêtes)
+    loader.loadTexture("assets/tiles/BlueWizard/2BlueWizardIdle/Chara - BlueIdle00000.png",
+        [this](const std::shared_ptr<sf::Texture>& texture, const CookedAssets::Entry&) {
+            m_wizardPreview = texture;
+        });
+
+    loader.loadTexture("assets/tiles/Chevre/chevre-face.png",
+        [this](const std::shared_ptr<sf::Texture>& texture, const CookedAssets::Entry&) {
+            m_goatPreview = texture;
+        });
 }
 
 void CharacterSelection::handleInput(sf::Keyboard::Key key, bool isPressed) {
@@ -52,13 +57,13 @@ void CharacterSelection::render(sf::RenderWindow& window) {
     window.clear(sf::Color::Black);
 
     // Vérifier que la font est chargée
-    if (!m_font.hasGlyph('A')) {
+    if (!m_font->hasGlyph('A')) {
         std::cerr << "Font not loaded, cannot render character selection" << std::endl;
         return;
     }
 
     // Titre
-    sf::Text title(m_font, "CHOISISSEZ VOTRE PERSONNAGE", 60);
+    sf::Text title(*m_font, "CHOISISSEZ VOTRE PERSONNAGE", 60);
     title.setFillColor(sf::Color(255, 215, 0));
     title.setOutlineColor(sf::Color::White);
     title.setOutlineThickness(3.0f);
@@ -68,7 +73,7 @@ void CharacterSelection::render(sf::RenderWindow& window) {
     window.draw(title);
 
     // Instructions
-    sf::Text instructions(m_font, "<- -> : Choisir | ENTREE : Valider", 24);
+    sf::Text instructions(*m_font, "<- -> : Choisir | ENTREE : Valider", 24);
     instructions.setFillColor(sf::Color::White);
     sf::FloatRect instrBounds = instructions.getLocalBounds();
     instructions.setPosition(sf::Vector2f(640.0f - (instrBounds.position.x + instrBounds.size.x) / 2.0f, 620.0f));
@@ -104,7 +109,7 @@ void CharacterSelection::render(sf::RenderWindow& window) {
     }
 
     // Label Magicien
-    sf::Text wizardLabel(m_font, "MAGICIEN", 32);
+    sf::Text wizardLabel(*m_font, "MAGICIEN", 32);
     wizardLabel.setFillColor(m_selectedCharacter == CharacterType::Wizard ?
                               sf::Color(255, 215, 0) : sf::Color::White);
     wizardLabel.setStyle(sf::Text::Bold);
@@ -138,7 +143,7 @@ void CharacterSelection::render(sf::RenderWindow& window) {
     }
 
     // Label Chèvre
-    sf::Text goatLabel(m_font, "CHEVRE", 32);
+    sf::Text goatLabel(*m_font, "CHEVRE", 32);
     goatLabel.setFillColor(m_selectedCharacter == CharacterType::Goat ?
                            sf::Color(255, 215, 0) : sf::Color::White);
     goatLabel.setStyle(sf::Text::Bold);
@@ -0,0 +1,58 @@
+#include "CookedAssets.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+CookedAssets& CookedAssets::getInstance() {
+    static CookedAssets instance;
+    return instance;
+}
+
+CookedAssets::CookedAssets() {
+    loadManifest();
+}
+
+void CookedAssets::loadManifest() {
+    std::ifstream file(MANIFEST_FILE);
+    if (!file.is_open()) {
+        return;  // Pas d'assets cuits: on charge les originaux
+    }
+
+    // Format d'une ligne: <largeur cuite> <hauteur cuite> <largeur source> <hauteur source> <mips 0/1> <chemin source>
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+
+        std::istringstream stream(line);
+        unsigned int cookedWidth = 0, cookedHeight = 0, sourceWidth = 0, sourceHeight = 0;
+        int mipmaps = 0;
+        if (!(stream >> cookedWidth >> cookedHeight >> sourceWidth >> sourceHeight >> mipmaps)) continue;
+
+        std::string sourcePath;
+        std::getline(stream >> std::ws, sourcePath);
+        if (sourcePath.empty() || sourceWidth == 0) continue;
+
+        Entry entry;
+        entry.path = std::string(COOKED_DIRECTORY) + "/" + sourcePath;
+        entry.scale = static_cast<float>(cookedWidth) / static_cast<float>(sourceWidth);
+        entry.mipmaps = mipmaps != 0;
+
+        if (std::filesystem::exists(entry.path)) {
+            m_entries[sourcePath] = entry;
+        }
+    }
+
+    std::cout << "Cooked assets: " << m_entries.size() << " images disponibles" << std::endl;
+}
+
+CookedAssets::Entry CookedAssets::resolve(const std::string& sourcePath) const {
+    auto it = m_entries.find(sourcePath);
+    if (it != m_entries.end()) {
+        return it->second;
+    }
+
+    Entry entry;
+    entry.path = sourcePath;
+    return entry;
+}
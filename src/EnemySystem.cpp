@@ -0,0 +1,404 @@
+#include "EnemySystem.hpp"
+#include "Random.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+EnemySystem::EnemySystem()
+    : m_killedCount(0)
+    , m_deathParticles(ParticleEffects::enemyDeath(), DEATH_PARTICLE_CAPACITY)
+    , m_worldBounds(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(0.0f, 0.0f))
+    , m_maxDetectionRange(0.0f)
+{
+}
+
+void EnemySystem::add(const sf::Vector2f& position, float scale) {
+    const std::size_t index = size();
+    m_positionsX.push_back(position.x);
+    m_positionsY.push_back(position.y);
+    m_interpolationX.push_back(position.x);
+    m_interpolationY.push_back(position.y);
+    m_scales.push_back(scale);
+    m_pulseTimers.push_back(0.0f);
+    m_damageTimers.push_back(0.0f);
+    m_detectionRanges.push_back(DETECTION_RANGE * scale);
+    m_moveSpeeds.push_back(MOVE_SPEED / scale);
+    m_alive.push_back(1);
+
+    // Nombre de particules proportionnel à la taille
+    int particleCount = static_cast<int>(PARTICLE_COUNT * scale);
+
+    // Initialiser les particules infectées qui tournent autour de l'ennemi
+    Pcg32& rng = Random::getInstance().stream(RandomStream::Enemies);
+
+    // Corps (avec contour) et particules en orbite (avec halo)
+    float renderRadius = ENEMY_RADIUS * scale + 2.0f;
+
+    m_orbitStarts.push_back(static_cast<std::uint32_t>(m_orbitAngles.size()));
+    m_orbitCounts.push_back(static_cast<std::uint32_t>(std::max(particleCount, 0)));
+    for (int i = 0; i < particleCount; ++i) {
+        m_orbitAngles.push_back(rng.range(0.0f, TWO_PI));
+        m_orbitRadii.push_back(rng.range(15.0f * scale, 25.0f * scale));
+        m_orbitSpeeds.push_back(rng.range(1.5f / scale, 3.0f / scale));  // Plus lent si plus gros
+        m_orbitSizes.push_back(rng.range(2.0f * scale, 4.0f * scale));
+
+        // Alterner entre rouge sombre et noir
+        if (rng.rangeInt(0, 1) == 0) {
+            m_orbitColors.push_back(sf::Color(120, 20, 20));  // Rouge sombre
+        } else {
+            m_orbitColors.push_back(sf::Color(30, 30, 30));   // Noir grisâtre
+        }
+
+        renderRadius = std::max(renderRadius, m_orbitRadii.back() + m_orbitSizes.back() * 1.5f);
+    }
+    m_renderRadii.push_back(renderRadius);
+
+    m_grid.insert(static_cast<int>(index), getBounds(index));
+    m_maxDetectionRange = std::max(m_maxDetectionRange, m_detectionRanges.back());
+}
+
+void EnemySystem::clear() {
+    m_positionsX.clear();
+    m_positionsY.clear();
+    m_interpolationX.clear();
+    m_interpolationY.clear();
+    m_scales.clear();
+    m_pulseTimers.clear();
+    m_damageTimers.clear();
+    m_detectionRanges.clear();
+    m_moveSpeeds.clear();
+    m_renderRadii.clear();
+    m_alive.clear();
+    m_orbitStarts.clear();
+    m_orbitCounts.clear();
+    m_killedCount = 0;
+
+    m_orbitAngles.clear();
+    m_orbitSpeeds.clear();
+    m_orbitRadii.clear();
+    m_orbitSizes.clear();
+    m_orbitColors.clear();
+
+    m_deathEffects.clear();
+    m_deathParticles.clear();
+    rebuildGrid();
+}
+
+void EnemySystem::setWorldBounds(const sf::FloatRect& worldBounds) {
+    m_worldBounds = worldBounds;
+    rebuildGrid();
+}
+
+void EnemySystem::rebuildGrid() {
+    m_grid.reset(m_worldBounds);
+    m_maxDetectionRange = 0.0f;
+
+    for (std::size_t i = 0; i < size(); ++i) {
+        if (!m_alive[i]) continue;
+        m_grid.insert(static_cast<int>(i), getBounds(i));
+        m_maxDetectionRange = std::max(m_maxDetectionRange, m_detectionRanges[i]);
+    }
+}
+
+void EnemySystem::update(sf::Time deltaTime, const sf::Vector2f& target) {
+    const float dt = deltaTime.asSeconds();
+
+    // Les ennemis tués au tick précédent quittent les tableaux
+    if (m_killedCount > 0) {
+        compact();
+    }
+
+    // Timers de pulsation et de dégâts (sans branche: vectorisé)
+    const std::size_t count = size();
+    float* pulseTimers = m_pulseTimers.data();
+    float* damageTimers = m_damageTimers.data();
+    for (std::size_t i = 0; i < count; ++i) {
+        pulseTimers[i] += dt;
+        damageTimers[i] -= damageTimers[i] > 0.0f ? dt : 0.0f;
+    }
+
+    // Particules en orbite: rotation, angle gardé entre 0 et 2π
+    const std::size_t orbitCount = m_orbitAngles.size();
+    float* angles = m_orbitAngles.data();
+    const float* speeds = m_orbitSpeeds.data();
+    for (std::size_t i = 0; i < orbitCount; ++i) {
+        float angle = angles[i] + speeds[i] * dt;
+        angles[i] = angle > TWO_PI ? angle - TWO_PI : angle;
+    }
+
+    updateDeathEffects(dt);
+    pursue(dt, target);
+}
+
+void EnemySystem::pursue(float dt, const sf::Vector2f& target) {
+    // Seuls les ennemis à moins de la plus grande portée de détection peuvent voir la cible
+    const sf::Vector2f range(m_maxDetectionRange, m_maxDetectionRange);
+    m_grid.query(sf::FloatRect(target - range, range * 2.0f), m_candidates);
+
+    // Regrouper les candidats dans des tableaux contigus
+    const std::size_t count = m_candidates.size();
+    m_stepX.resize(count);
+    m_stepY.resize(count);
+    m_stepRange.resize(count);
+    m_stepSpeed.resize(count);
+    for (std::size_t k = 0; k < count; ++k) {
+        const int i = m_candidates[k];
+        m_stepX[k] = target.x - m_positionsX[i];
+        m_stepY[k] = target.y - m_positionsY[i];
+        m_stepRange[k] = m_detectionRanges[i];
+        m_stepSpeed[k] = m_moveSpeeds[i];
+    }
+
+    // Déplacement vers la cible si elle est à portée (nul sinon), sans branche: vectorisé
+    float* stepX = m_stepX.data();
+    float* stepY = m_stepY.data();
+    const float* stepRange = m_stepRange.data();
+    const float* stepSpeed = m_stepSpeed.data();
+    for (std::size_t k = 0; k < count; ++k) {
+        float distance = std::sqrt(stepX[k] * stepX[k] + stepY[k] * stepY[k]);
+        bool inRange = distance < stepRange[k] && distance > 0.0f;
+        float factor = inRange ? stepSpeed[k] * dt / std::max(distance, 1e-6f) : 0.0f;
+        stepX[k] *= factor;
+        stepY[k] *= factor;
+    }
+
+    // Appliquer les déplacements et suivre les changements de cellule
+    for (std::size_t k = 0; k < count; ++k) {
+        if (stepX[k] == 0.0f && stepY[k] == 0.0f) continue;
+
+        const int i = m_candidates[k];
+        sf::FloatRect oldBounds = getBounds(i);
+        m_positionsX[i] += stepX[k];
+        m_positionsY[i] += stepY[k];
+        m_grid.update(i, oldBounds, getBounds(i));
+    }
+}
+
+void EnemySystem::compact() {
+    std::size_t write = 0;
+    std::uint32_t orbitWrite = 0;
+
+    for (std::size_t read = 0; read < size(); ++read) {
+        if (!m_alive[read]) continue;
+
+        m_positionsX[write] = m_positionsX[read];
+        m_positionsY[write] = m_positionsY[read];
+        m_interpolationX[write] = m_interpolationX[read];
+        m_interpolationY[write] = m_interpolationY[read];
+        m_scales[write] = m_scales[read];
+        m_pulseTimers[write] = m_pulseTimers[read];
+        m_damageTimers[write] = m_damageTimers[read];
+        m_detectionRanges[write] = m_detectionRanges[read];
+        m_moveSpeeds[write] = m_moveSpeeds[read];
+        m_renderRadii[write] = m_renderRadii[read];
+        m_alive[write] = 1;
+
+        // Les particules en orbite se décalent vers le début (jamais au-delà de leur position)
+        const std::uint32_t start = m_orbitStarts[read];
+        const std::uint32_t orbitCount = m_orbitCounts[read];
+        for (std::uint32_t j = 0; j < orbitCount; ++j) {
+            m_orbitAngles[orbitWrite + j] = m_orbitAngles[start + j];
+            m_orbitSpeeds[orbitWrite + j] = m_orbitSpeeds[start + j];
+            m_orbitRadii[orbitWrite + j] = m_orbitRadii[start + j];
+            m_orbitSizes[orbitWrite + j] = m_orbitSizes[start + j];
+            m_orbitColors[orbitWrite + j] = m_orbitColors[start + j];
+        }
+        m_orbitStarts[write] = orbitWrite;
+        m_orbitCounts[write] = orbitCount;
+        orbitWrite += orbitCount;
+        write++;
+    }
+
+    m_positionsX.resize(write);
+    m_positionsY.resize(write);
+    m_interpolationX.resize(write);
+    m_interpolationY.resize(write);
+    m_scales.resize(write);
+    m_pulseTimers.resize(write);
+    m_damageTimers.resize(write);
+    m_detectionRanges.resize(write);
+    m_moveSpeeds.resize(write);
+    m_renderRadii.resize(write);
+    m_alive.resize(write);
+    m_orbitStarts.resize(write);
+    m_orbitCounts.resize(write);
+
+    m_orbitAngles.resize(orbitWrite);
+    m_orbitSpeeds.resize(orbitWrite);
+    m_orbitRadii.resize(orbitWrite);
+    m_orbitSizes.resize(orbitWrite);
+    m_orbitColors.resize(orbitWrite);
+
+    m_killedCount = 0;
+
+    // Les index ont changé
+    rebuildGrid();
+}
+
+void EnemySystem::queryBodies(const sf::FloatRect& area, std::vector<int>& results) {
+    m_grid.query(area, results);
+
+    // Test exact sur le corps (la grille ne donne que les cellules)
+    results.erase(std::remove_if(results.begin(), results.end(),
+        [this, &area](int index) { return !getBounds(index).findIntersection(area).has_value(); }),
+        results.end());
+}
+
+void EnemySystem::kill(std::size_t index) {
+    if (!m_alive[index]) return;  // Déjà tué
+
+    const sf::Vector2f position = getPosition(index);
+    const float scale = m_scales[index];
+
+    m_grid.remove(static_cast<int>(index), getBounds(index));
+    m_alive[index] = 0;
+    m_killedCount++;
+
+    DeathEffect effect;
+    effect.position = position;
+    effect.scale = scale;
+    effect.timer = DEATH_DURATION;
+    effect.shockwaveRadius = ENEMY_RADIUS * scale;
+    effect.shockwaveAlpha = 255.0f;
+
+    // Créer l'explosion de particules (nombre proportionnel à la taille)
+    std::size_t before = m_deathParticles.getCount();
+    m_deathParticles.burst(position, static_cast<int>(30 * scale), scale);
+
+    // Convertir les particules infectées en particules de mort (elles explosent aussi)
+    Pcg32& rng = Random::getInstance().stream(RandomStream::Enemies);
+    const std::uint32_t start = m_orbitStarts[index];
+    for (std::uint32_t j = start; j < start + m_orbitCounts[index]; ++j) {
+        sf::Vector2f particlePosition(position.x + std::cos(m_orbitAngles[j]) * m_orbitRadii[j],
+                                      position.y + std::sin(m_orbitAngles[j]) * m_orbitRadii[j]);
+
+        // Éjecter dans la direction radiale
+        float ejectionAngle = m_orbitAngles[j] + rng.range(0.0f, TWO_PI) * 0.3f;
+        float speed = rng.range(150.0f, 400.0f) * 0.8f;
+        m_deathParticles.spawn(particlePosition, sf::Vector2f(std::cos(ejectionAngle) * speed, std::sin(ejectionAngle) * speed),
+                               m_orbitSizes[j] * 2.0f, m_orbitColors[j]);
+    }
+
+    std::cout << "Enemy death triggered with " << m_deathParticles.getCount() - before << " particles!" << std::endl;
+    m_deathEffects.push_back(effect);
+}
+
+void EnemySystem::updateDeathEffects(float dt) {
+    for (DeathEffect& effect : m_deathEffects) {
+        effect.timer -= dt;
+
+        // Mise à jour de l'onde de choc
+        effect.shockwaveRadius += 400.0f * effect.scale * dt;  // Expansion rapide
+        effect.shockwaveAlpha -= 400.0f * dt;  // Disparition progressive
+        if (effect.shockwaveAlpha < 0.0f) effect.shockwaveAlpha = 0.0f;
+    }
+
+    // Mise à jour des particules de mort
+    m_deathParticles.update(sf::seconds(dt));
+
+    // Quand l'animation est finie, retirer l'explosion
+    m_deathEffects.erase(
+        std::remove_if(m_deathEffects.begin(), m_deathEffects.end(),
+            [](const DeathEffect& effect) { return effect.timer <= 0.0f; }),
+        m_deathEffects.end());
+}
+
+sf::FloatRect EnemySystem::getBounds(std::size_t index) const {
+    float scaledRadius = ENEMY_RADIUS * m_scales[index];
+    return sf::FloatRect(
+        sf::Vector2f(m_positionsX[index] - scaledRadius, m_positionsY[index] - scaledRadius),
+        sf::Vector2f(scaledRadius * 2.0f, scaledRadius * 2.0f)
+    );
+}
+
+sf::FloatRect EnemySystem::getRenderBounds(std::size_t index) const {
+    float radius = m_renderRadii[index];
+    return sf::FloatRect(
+        sf::Vector2f(m_positionsX[index] - radius, m_positionsY[index] - radius),
+        sf::Vector2f(radius * 2.0f, radius * 2.0f)
+    );
+}
+
+sf::FloatRect EnemySystem::getDeathEffectBounds(std::size_t effectIndex) const {
+    const DeathEffect& effect = m_deathEffects[effectIndex];
+
+    // Onde de choc (avec son contour) et flash central
+    float radius = std::max(effect.shockwaveRadius + 4.0f * effect.scale, ENEMY_RADIUS * effect.scale * 3.0f);
+    return sf::FloatRect(effect.position - sf::Vector2f(radius, radius), sf::Vector2f(radius * 2.0f, radius * 2.0f));
+}
+
+void EnemySystem::saveInterpolationState() {
+    // assign() garde la capacité: pas d'allocation d'un tick à l'autre
+    m_interpolationX.assign(m_positionsX.begin(), m_positionsX.end());
+    m_interpolationY.assign(m_positionsY.begin(), m_positionsY.end());
+}
+
+sf::Vector2f EnemySystem::getRenderPosition(std::size_t index, float interpolation) const {
+    return sf::Vector2f(m_interpolationX[index] + (m_positionsX[index] - m_interpolationX[index]) * interpolation,
+                        m_interpolationY[index] + (m_positionsY[index] - m_interpolationY[index]) * interpolation);
+}
+
+void EnemySystem::render(std::size_t index, ParticleBatch& batch, float interpolation) const {
+    if (!m_alive[index]) return;
+
+    const sf::Vector2f position = getRenderPosition(index, interpolation);
+    const float scale = m_scales[index];
+
+    // Rayon du corps avec l'échelle
+    float scaledRadius = ENEMY_RADIUS * scale;
+    float scaledCoreRadius = CORE_RADIUS * scale;
+
+    // Effet de pulsation pour le corps de l'ennemi
+    float pulseFactor = 0.5f + 0.5f * std::sin(m_pulseTimers[index] * 3.0f);
+
+    // Corps principal de l'ennemi (cercle rouge sombre/noir)
+    // Gradient du rouge sombre au noir avec la pulsation
+    unsigned char red = static_cast<unsigned char>(80 + 40 * pulseFactor);
+    batch.addCircle(position, scaledRadius, sf::Color(red, 10, 10));
+
+    // Contour plus sombre
+    batch.addRing(position, scaledRadius, 2.0f, sf::Color(20, 5, 5));
+
+    // Noyau central plus sombre (infecté)
+    batch.addCircle(position, scaledCoreRadius, sf::Color(30, 5, 5));
+}
+
+void EnemySystem::renderOrbits(std::size_t index, ParticleBatch& batch, float interpolation) const {
+    if (!m_alive[index]) return;
+
+    const sf::Vector2f position = getRenderPosition(index, interpolation);
+
+    // Dessiner les particules infectées qui tournent autour
+    const std::uint32_t start = m_orbitStarts[index];
+    for (std::uint32_t j = start; j < start + m_orbitCounts[index]; ++j) {
+        // Calculer la position de la particule en orbite
+        sf::Vector2f particlePosition(position.x + std::cos(m_orbitAngles[j]) * m_orbitRadii[j],
+                                      position.y + std::sin(m_orbitAngles[j]) * m_orbitRadii[j]);
+
+        // Particule principale et son halo transparent
+        batch.addGlow(particlePosition, m_orbitSizes[j] * 1.5f, m_orbitSizes[j], m_orbitColors[j], 80.0f / 255.0f);
+    }
+}
+
+void EnemySystem::renderDeathEffect(std::size_t effectIndex, ParticleBatch& batch) const {
+    const DeathEffect& effect = m_deathEffects[effectIndex];
+
+    // Dessiner l'onde de choc (cercle qui s'étend)
+    if (effect.shockwaveAlpha > 0.0f) {
+        // Onde de choc externe (orange)
+        batch.addRing(effect.position, effect.shockwaveRadius, 4.0f * effect.scale,
+                      sf::Color(255, 150, 50, static_cast<unsigned char>(effect.shockwaveAlpha)));
+
+        // Onde de choc interne (jaune)
+        batch.addRing(effect.position, effect.shockwaveRadius * 0.7f, 2.0f * effect.scale,
+                      sf::Color(255, 255, 100, static_cast<unsigned char>(effect.shockwaveAlpha * 0.7f)));
+    }
+
+    // Flash central au début de l'explosion
+    if (effect.timer > DEATH_DURATION - 0.15f) {
+        float flashProgress = (effect.timer - (DEATH_DURATION - 0.15f)) / 0.15f;
+        float flashSize = (ENEMY_RADIUS * effect.scale * 3.0f) * (1.0f - flashProgress);
+
+        batch.addCircle(effect.position, flashSize, sf::Color(255, 255, 200, static_cast<unsigned char>(flashProgress * 200)));
+    }
+}
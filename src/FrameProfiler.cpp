@@ -0,0 +1,228 @@
+#include "FrameProfiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace {
+    struct StageInfo {
+        const char* name;
+        sf::Color color;
+        bool nested;  // Inclus dans une autre étape: pas empilé dans le graphe
+    };
+
+    const std::array<StageInfo, FrameProfiler::STAGE_COUNT> STAGE_INFO = {{
+        {"events",    sf::Color(180, 180, 180), false},
+        {"player",    sf::Color(80, 160, 255),  false},
+        {"level",     sf::Color(80, 220, 120),  false},
+        {"collision", sf::Color(40, 140, 70),   true},
+        {"ambient",   sf::Color(150, 240, 170), true},
+        {"world",     sf::Color(255, 170, 60),  false},
+        {"tiles",     sf::Color(200, 110, 20),  true},
+        {"hud",       sf::Color(220, 90, 220),  false},
+        {"display",   sf::Color(230, 60, 60),   false},
+    }};
+
+    // Percentile par sélection partielle (les valeurs sont réordonnées)
+    float percentile(std::vector<float>& values, float p) {
+        if (values.empty()) return 0.0f;
+        std::size_t index = std::min(values.size() - 1, static_cast<std::size_t>(p * values.size()));
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+
+    void addRect(std::vector<sf::Vertex>& vertices, float x, float y, float width, float height, sf::Color color) {
+        sf::Vector2f a(x, y), b(x + width, y), c(x, y + height), d(x + width, y + height);
+        vertices.push_back({a, color});
+        vertices.push_back({b, color});
+        vertices.push_back({c, color});
+        vertices.push_back({c, color});
+        vertices.push_back({b, color});
+        vertices.push_back({d, color});
+    }
+}
+
+FrameProfiler& FrameProfiler::getInstance() {
+    static FrameProfiler instance;
+    return instance;
+}
+
+FrameProfiler::FrameProfiler()
+    : m_enabled(false)
+    , m_inFrame(false)
+    , m_head(0)
+    , m_count(0)
+    , m_frameNumber(0)
+    , m_framesSinceStats(0)
+{
+}
+
+const char* FrameProfiler::getStageName(ProfileStage stage) {
+    return STAGE_INFO[static_cast<std::size_t>(stage)].name;
+}
+
+void FrameProfiler::setEnabled(bool enabled) {
+    m_enabled = enabled;
+    // La frame en cours a commencé sans mesure: elle sera ignorée
+    m_inFrame = false;
+    m_current.fill(0.0f);
+    std::cout << "Frame profiler " << (enabled ? "enabled" : "disabled") << std::endl;
+}
+
+void FrameProfiler::beginFrame() {
+    m_inFrame = m_enabled;
+    if (!m_inFrame) return;
+
+    m_current.fill(0.0f);
+    m_frameStart = std::chrono::steady_clock::now();
+}
+
+void FrameProfiler::endFrame() {
+    if (!m_inFrame) return;
+    m_inFrame = false;
+
+    FrameSample& sample = m_history[m_head];
+    sample.stages = m_current;
+    sample.total = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - m_frameStart).count();
+
+    m_head = (m_head + 1) % HISTORY_SIZE;
+    m_count = std::min(m_count + 1, HISTORY_SIZE);
+    m_frameNumber++;
+
+    if (++m_framesSinceStats >= STATS_INTERVAL) {
+        m_framesSinceStats = 0;
+        updateStats();
+    }
+}
+
+void FrameProfiler::updateStats() {
+    std::vector<float> values;
+    values.reserve(m_count);
+
+    for (std::size_t s = 0; s < STAGE_COUNT; ++s) {
+        values.clear();
+        for (std::size_t i = 0; i < m_count; ++i) {
+            values.push_back(m_history[i].stages[s]);
+        }
+        m_stats[s].p50 = percentile(values, 0.50f);
+        m_stats[s].p95 = percentile(values, 0.95f);
+        m_stats[s].p99 = percentile(values, 0.99f);
+    }
+
+    values.clear();
+    for (std::size_t i = 0; i < m_count; ++i) {
+        values.push_back(m_history[i].total);
+    }
+    m_frameStats.p50 = percentile(values, 0.50f);
+    m_frameStats.p95 = percentile(values, 0.95f);
+    m_frameStats.p99 = percentile(values, 0.99f);
+}
+
+void FrameProfiler::render(sf::RenderTarget& target, const sf::Font& font) {
+    if (!m_enabled) return;
+
+    const float graphWidth = static_cast<float>(HISTORY_SIZE);
+    const float graphHeight = 120.0f;
+    const float left = target.getView().getSize().x - graphWidth - 20.0f;
+    const float top = 20.0f;
+    const float pixelsPerMs = graphHeight / GRAPH_SCALE_MS;
+
+    std::vector<sf::Vertex> vertices;
+    vertices.reserve((m_count * STAGE_COUNT + 4) * 6);
+
+    // Fond et repères à 16.7 ms (60 FPS) et 33.3 ms (30 FPS)
+    addRect(vertices, left, top, graphWidth, graphHeight, sf::Color(0, 0, 0, 160));
+    addRect(vertices, left, top + graphHeight - 16.7f * pixelsPerMs, graphWidth, 1.0f, sf::Color(255, 255, 255, 90));
+    addRect(vertices, left, top, graphWidth, 1.0f, sf::Color(255, 255, 255, 90));
+
+    // Une colonne par frame, de la plus ancienne (à gauche) à la plus récente
+    std::size_t oldest = (m_head + HISTORY_SIZE - m_count) % HISTORY_SIZE;
+    float x = left + graphWidth - static_cast<float>(m_count);
+    for (std::size_t i = 0; i < m_count; ++i, x += 1.0f) {
+        const FrameSample& sample = m_history[(oldest + i) % HISTORY_SIZE];
+        float y = top + graphHeight;
+        float stacked = 0.0f;
+
+        for (std::size_t s = 0; s < STAGE_COUNT; ++s) {
+            if (STAGE_INFO[s].nested || sample.stages[s] <= 0.0f) continue;
+            float height = std::min(sample.stages[s] * pixelsPerMs, y - top);
+            if (height <= 0.0f) break;
+            y -= height;
+            stacked += sample.stages[s];
+            addRect(vertices, x, y, 1.0f, height, STAGE_INFO[s].color);
+        }
+
+        // Temps hors des étapes mesurées (boucle, attente) en gris foncé
+        float untracked = std::min((sample.total - stacked) * pixelsPerMs, y - top);
+        if (untracked > 0.0f) {
+            addRect(vertices, x, y - untracked, 1.0f, untracked, sf::Color(90, 90, 90));
+        }
+    }
+
+    // Légende: pastille de couleur, nom de l'étape et percentiles
+    const float legendTop = top + graphHeight + 8.0f;
+    const float lineHeight = 15.0f;
+    addRect(vertices, left, legendTop - 3.0f, graphWidth, (STAGE_COUNT + 2) * lineHeight + 6.0f, sf::Color(0, 0, 0, 160));
+    for (std::size_t s = 0; s < STAGE_COUNT; ++s) {
+        addRect(vertices, left + 4.0f, legendTop + (s + 1) * lineHeight + 3.0f, 9.0f, 9.0f, STAGE_INFO[s].color);
+    }
+
+    target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles);
+
+    // Une colonne de texte multiligne par valeur (la police n'est pas à chasse fixe)
+    std::string columns[4] = {"ms", "p50", "p95", "p99"};
+    char value[16];
+    auto appendRow = [&](const std::string& name, const StageStats& stats) {
+        columns[0] += "\n" + name;
+        std::snprintf(value, sizeof(value), "\n%.2f", stats.p50);
+        columns[1] += value;
+        std::snprintf(value, sizeof(value), "\n%.2f", stats.p95);
+        columns[2] += value;
+        std::snprintf(value, sizeof(value), "\n%.2f", stats.p99);
+        columns[3] += value;
+    };
+    for (std::size_t s = 0; s < STAGE_COUNT; ++s) {
+        appendRow(STAGE_INFO[s].nested ? std::string("  ") + STAGE_INFO[s].name : STAGE_INFO[s].name, m_stats[s]);
+    }
+    appendRow("total", m_frameStats);
+
+    const float columnX[4] = {18.0f, 110.0f, 170.0f, 230.0f};
+    for (int c = 0; c < 4; ++c) {
+        sf::Text text(font, columns[c], 12);
+        text.setLineSpacing(lineHeight / font.getLineSpacing(12));
+        text.setPosition(sf::Vector2f(left + columnX[c], legendTop));
+        text.setFillColor(sf::Color(230, 230, 230));
+        target.draw(text);
+    }
+}
+
+bool FrameProfiler::dumpCsv(const std::string& filepath) const {
+    if (m_count == 0) return false;
+
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        std::cerr << "Frame profiler: cannot write " << filepath << std::endl;
+        return false;
+    }
+
+    file << "frame,total_ms";
+    for (const StageInfo& info : STAGE_INFO) {
+        file << "," << info.name << "_ms";
+    }
+    file << "\n";
+
+    std::size_t oldest = (m_head + HISTORY_SIZE - m_count) % HISTORY_SIZE;
+    std::size_t firstFrame = m_frameNumber - m_count;
+    for (std::size_t i = 0; i < m_count; ++i) {
+        const FrameSample& sample = m_history[(oldest + i) % HISTORY_SIZE];
+        file << firstFrame + i << "," << sample.total;
+        for (float value : sample.stages) {
+            file << "," << value;
+        }
+        file << "\n";
+    }
+
+    std::cout << "Frame profile written to " << filepath << " (" << m_count << " frames)" << std::endl;
+    return true;
+}
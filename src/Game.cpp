@@ -1,4 +1,6 @@
 #include "Game.hpp"
+#include "FrameProfiler.hpp"
+#include "ResourceCache.hpp"
 #include <iostream>
 
 const sf::Time Game::TimePerFrame = sf::seconds(1.f / 60.f);
@@ -11,6 +13,7 @@ Game::Game()
     , m_camera(std::make_unique<Camera>(1280.0f, 720.0f))
     , m_level(std::make_unique<Level>())
     , m_editor(std::make_unique<LevelEditor>(64))
+    , m_preloadLevelNumber(-1)
     , m_isSelectingCharacter(true)
     , m_isPaused(false)
     , m_isFinished(false)
@@ -18,14 +21,41 @@ Game::Game()
     , m_isGameComplete(false)
     , m_isGameOver(false)
     , m_isLevelSelectOpen(false)
+    , m_showRenderStats(false)
     , m_currentLevelNumber(0)  // Commencer au prologue
     , m_selectedLevelInMenu(0)
 {
-    m_window.setFramerateLimit(60);
+    // Affichage au rythme de l'écran (120-240 Hz): la simulation reste à 60 Hz, le rendu interpole
+    m_window.setVerticalSyncEnabled(true);
+    // Certains pilotes ignorent la vsync: plafond au-dessus des écrans visés pour ne pas tourner à vide
+    m_window.setFramerateLimit(FALLBACK_FRAMERATE_LIMIT);
 
     // Charger la police
-    if (!m_font.openFromFile("assets/Arial.ttf")) {
+    m_font = ResourceCache::getInstance().getFont("assets/Arial.ttf");
+    if (!m_font) {
         std::cerr << "Failed to load font for victory message" << std::endl;
+        m_font = std::make_shared<sf::Font>();
+    }
+
+    // Atlas SDF des grands titres, construit une fois: toutes leurs tailles en sortent sans rastérisation
+    auto& cache = ResourceCache::getInstance();
+    m_titleFont = cache.find<SdfFont>("sdf:assets/Arial.ttf:bold");
+    if (!m_titleFont) {
+        m_titleFont = std::make_shared<SdfFont>();
+        if (!m_titleFont->build(*m_font, true)) {
+            std::cerr << "Failed to build SDF title font" << std::endl;
+        }
+        cache.store("sdf:assets/Arial.ttf:bold", m_titleFont);
+    }
+    m_hud = std::make_unique<Hud>(m_font, m_titleFont, m_window.getSize());
+
+    // Textures décodées en parallèle: le démarrage dure le temps de l'image la plus lente
+    {
+        AssetLoader loader;
+        m_level->requestAssets(loader);
+        m_editor->requestAssets(loader);
+        m_characterSelection->requestAssets(loader);
+        runLoadingScreen(loader);
     }
 
     // Charger le niveau
@@ -49,28 +79,103 @@ Game::Game()
 }
 
 Game::~Game() {
+    // Historique du profileur (uniquement si l'overlay a été activé pendant la partie)
+    FrameProfiler::getInstance().dumpCsv("frame_profile.csv");
 }
 
 void Game::run() {
     sf::Clock clock;
     sf::Time timeSinceLastUpdate = sf::Time::Zero;
 
+    FrameProfiler& profiler = FrameProfiler::getInstance();
+
     while (m_window.isOpen()) {
+        profiler.beginFrame();
+
         sf::Time deltaTime = clock.restart();
         timeSinceLastUpdate += deltaTime;
 
-        while (timeSinceLastUpdate > TimePerFrame) {
+        // Événements une fois par frame affichée, pas à chaque pas de simulation
+        {
+            ProfileScope scope(ProfileStage::Events);
+            processEvents();
+        }
+
+        // Simulation à pas fixe (60 Hz), indépendante de la fréquence d'affichage
+        int steps = 0;
+        while (timeSinceLastUpdate >= TimePerFrame && steps < MAX_STEPS_PER_FRAME) {
             timeSinceLastUpdate -= TimePerFrame;
+            ++steps;
 
-            processEvents();
+            // État du début du tick, même en pause (sinon l'image oscillerait entre deux états)
+            saveInterpolationState();
 
             if (!m_isPaused) {
                 update(TimePerFrame);
             }
         }
 
-        render();
+        // Trop de retard (machine trop lente, fenêtre déplacée...): abandonner le temps restant
+        // plutôt que d'enchaîner des frames de plus en plus chargées en rattrapage
+        if (steps == MAX_STEPS_PER_FRAME && timeSinceLastUpdate >= TimePerFrame) {
+            timeSinceLastUpdate = sf::Time::Zero;
+        }
+
+        // Affichage entre l'état précédent et l'état actuel (fraction du pas suivant déjà écoulée)
+        render(timeSinceLastUpdate / TimePerFrame);
+        profiler.endFrame();
+    }
+}
+
+void Game::runLoadingScreen(AssetLoader& loader) {
+    sf::Clock loadingClock;
+
+    while (m_window.isOpen() && !loader.isDone()) {
+        while (auto event = m_window.pollEvent()) {
+            if (event->is<sf::Event::Closed>()) {
+                m_window.close();
+            }
+        }
+
+        loader.pump(UPLOADS_PER_FRAME);
+        renderLoadingScreen(loader.getProgress());
     }
+
+    std::cout << "✓ " << loader.getCompletedCount() << " images chargées en "
+              << loadingClock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+}
+
+void Game::renderLoadingScreen(float progress) {
+    m_window.clear(sf::Color::Black);
+    m_window.setView(m_window.getDefaultView());
+
+    const float barWidth = 400.0f;
+    const float barHeight = 12.0f;
+    const sf::Vector2f barPosition(640.0f - barWidth / 2.0f, 400.0f);
+
+    // Texte "Chargement..."
+    sf::Text loadingText(*m_font, "Chargement...", 32);
+    sf::FloatRect textBounds = loadingText.getLocalBounds();
+    loadingText.setOrigin(sf::Vector2f(textBounds.position.x + textBounds.size.x / 2.0f, 0.0f));
+    loadingText.setPosition(sf::Vector2f(640.0f, 330.0f));
+    loadingText.setFillColor(sf::Color(255, 215, 0)); // Jaune doré
+    m_window.draw(loadingText);
+
+    // Fond de la barre (gris foncé)
+    sf::RectangleShape barBackground(sf::Vector2f(barWidth, barHeight));
+    barBackground.setPosition(barPosition);
+    barBackground.setFillColor(sf::Color(40, 40, 40));
+    barBackground.setOutlineColor(sf::Color(200, 200, 200));
+    barBackground.setOutlineThickness(2.0f);
+    m_window.draw(barBackground);
+
+    // Progression
+    sf::RectangleShape bar(sf::Vector2f(barWidth * progress, barHeight));
+    bar.setPosition(barPosition);
+    bar.setFillColor(sf::Color(255, 215, 0));
+    m_window.draw(bar);
+
+    m_window.display();
 }
 
 void Game::processEvents() {
@@ -88,8 +193,17 @@ void Game::processEvents() {
                     m_isSelectingCharacter = false;
                     CharacterType selectedChar = m_characterSelection->getSelectedCharacter();
 
-                    // Créer le joueur avec le personnage sélectionné
-                    m_player = std::make_unique<Player>(selectedChar);
+                    // Créer le joueur avec le personnage sélectionné (frames décodées en parallèle)
+                    {
+                        AssetLoader loader;
+                        m_player = std::make_unique<Player>(selectedChar, false, &loader);
+                        runLoadingScreen(loader);
+                        m_player->finishLoading();
+                    }
+
+                    // L'écran de sélection ne sert plus: ses previews quittent le cache
+                    m_characterSelection.reset();
+                    ResourceCache::getInstance().evictUnused();
 
                     // Positionner le joueur au portail d'entrée
                     sf::Vector2f playerStartPos;
@@ -102,6 +216,7 @@ void Game::processEvents() {
                     }
                     m_player->setPosition(playerStartPos);
                     m_camera->setPosition(m_player->getPosition());
+                    m_player->saveInterpolationState();  // Téléportation: pas d'interpolation
                 }
                 continue;  // Ne pas traiter les autres touches pendant la sélection
             }
@@ -113,6 +228,7 @@ void Game::processEvents() {
 
                 // Si on sort de l'éditeur, recharger le niveau prologue
                 if (!m_isEditorMode) {
+                    cancelPreload();
                     if (m_level->loadFromFile("levels/prologue.json")) {
                         // Repositionner le joueur au centre du portail d'entrée
                         if (m_level->hasEntrancePortal()) {
@@ -123,6 +239,7 @@ void Game::processEvents() {
                             playerStartPos.y = portalPos.y + 32.0f - 51.0f;  // Centre du portail - moitié hauteur joueur
                             m_player->setPosition(playerStartPos);
                             m_camera->setPosition(playerStartPos);
+                            m_player->saveInterpolationState();  // Téléportation: pas d'interpolation
                         }
                     } else {
                         std::cerr << "Failed to reload prologue level!" << std::endl;
@@ -130,6 +247,24 @@ void Game::processEvents() {
                 }
             }
 
+            // Basculer le backend de rendu des tiles avec F2 (chunks <-> shader)
+            if (keyPressed->code == sf::Keyboard::Key::F2 && !m_isEditorMode) {
+                Tilemap& tilemap = m_level->getTilemap();
+                bool useShader = tilemap.getRenderMode() == Tilemap::RenderMode::Chunks;
+                tilemap.setRenderMode(useShader ? Tilemap::RenderMode::Shader : Tilemap::RenderMode::Chunks);
+            }
+
+            // Afficher / masquer les statistiques de culling avec F3
+            if (keyPressed->code == sf::Keyboard::Key::F3 && !m_isEditorMode) {
+                m_showRenderStats = !m_showRenderStats;
+            }
+
+            // Afficher / masquer le profileur de frames avec F4
+            if (keyPressed->code == sf::Keyboard::Key::F4) {
+                FrameProfiler& profiler = FrameProfiler::getInstance();
+                profiler.setEnabled(!profiler.isEnabled());
+            }
+
             // Vérifier si l'éditeur veut quitter le jeu
             if (m_isEditorMode && m_editor->wantsToQuit()) {
                 m_window.close();
@@ -273,6 +408,9 @@ void Game::update(sf::Time deltaTime) {
             transitionClock.restart();
             transitionStarted = true;
             std::cout << "Starting 3 second transition timer..." << std::endl;
+
+            // Préparer le niveau suivant pendant l'affichage du message de victoire
+            startPreload(m_currentLevelNumber + 1);
         }
 
         if (transitionClock.getElapsedTime().asSeconds() >= 3.0f) {
@@ -287,10 +425,16 @@ void Game::update(sf::Time deltaTime) {
         transitionStarted = false;
     }
 
-    m_player->update(deltaTime);
+    {
+        ProfileScope scope(ProfileStage::PlayerUpdate);
+        m_player->update(deltaTime);
+    }
 
     // Mettre à jour le niveau
-    m_level->update(deltaTime, *m_player);
+    {
+        ProfileScope scope(ProfileStage::LevelUpdate);
+        m_level->update(deltaTime, *m_player);
+    }
 
     // Vérifier si le joueur est tombé trop bas (chute dans le vide)
     // Le niveau fait 20 tiles de haut * 64 pixels = 1280 pixels
@@ -359,6 +503,7 @@ void Game::update(sf::Time deltaTime) {
                 m_player->setPosition(respawnPosition);
                 m_player->setVelocity(sf::Vector2f(0.0f, 0.0f));
                 m_camera->setPosition(respawnPosition);
+                m_player->saveInterpolationState();  // Téléportation: pas d'interpolation
             }
         }
     }
@@ -376,7 +521,15 @@ void Game::update(sf::Time deltaTime) {
     m_camera->update(m_player->getPosition(), deltaTime, playerIsMoving);
 }
 
-void Game::render() {
+void Game::saveInterpolationState() {
+    if (m_player) {
+        m_player->saveInterpolationState();
+    }
+    m_level->saveInterpolationState();
+    m_camera->saveInterpolationState();
+}
+
+void Game::render(float interpolation) {
     m_window.clear(sf::Color::Black); // Noir pour mieux voir les tiles
 
     // Si on est en train de sélectionner le personnage
@@ -401,145 +554,49 @@ void Game::render() {
     }
 
     // Appliquer la vue de la caméra pour les éléments du monde
-    m_window.setView(m_camera->getView());
+    m_window.setView(m_camera->getView(interpolation));
+
+    {
+        ProfileScope scope(ProfileStage::WorldRender);
 
-    // Dessiner le niveau
-    m_level->render(m_window);
+        // Dessiner le niveau
+        m_level->render(m_window, *m_camera, interpolation);
 
-    // Dessiner le joueur
-    m_player->render(m_window);
+        // Dessiner le joueur
+        m_player->render(m_window, interpolation);
+    }
 
     // Revenir à la vue par défaut pour l'interface utilisateur (menu pause)
     m_window.setView(m_window.getDefaultView());
 
-    // Afficher la barre de vie en haut à gauche (sauf en mode éditeur)
-    if (!m_isEditorMode) {
-        const float barX = 20.0f;
-        const float barY = 20.0f;
-        const float barWidth = 200.0f;
-        const float barHeight = 15.0f;
-        const float borderThickness = 2.0f;
-
-        // Fond de la barre (gris foncé)
-        sf::RectangleShape healthBarBg(sf::Vector2f(barWidth, barHeight));
-        healthBarBg.setPosition(sf::Vector2f(barX, barY));
-        healthBarBg.setFillColor(sf::Color(40, 40, 40));
-        healthBarBg.setOutlineColor(sf::Color(200, 200, 200));
-        healthBarBg.setOutlineThickness(borderThickness);
-        m_window.draw(healthBarBg);
-
-        // Barre de vie (rouge qui devient orange/jaune selon la vie)
-        float healthRatio = static_cast<float>(m_player->getHealth()) / static_cast<float>(m_player->getMaxHealth());
-        float currentBarWidth = barWidth * healthRatio;
-
-        // Couleur en fonction de la vie restante
-        sf::Color healthColor;
-        if (healthRatio > 0.6f) {
-            healthColor = sf::Color(50, 200, 50); // Vert
-        } else if (healthRatio > 0.3f) {
-            healthColor = sf::Color(255, 200, 0); // Orange
-        } else {
-            healthColor = sf::Color(220, 50, 50); // Rouge
-        }
-
-        sf::RectangleShape healthBar(sf::Vector2f(currentBarWidth, barHeight));
-        healthBar.setPosition(sf::Vector2f(barX, barY));
-        healthBar.setFillColor(healthColor);
-        m_window.draw(healthBar);
-
-        // Effet de lueur sur la barre
-        sf::RectangleShape healthGlow(sf::Vector2f(currentBarWidth, barHeight));
-        healthGlow.setPosition(sf::Vector2f(barX, barY));
-        healthGlow.setFillColor(sf::Color(255, 255, 255, 50));
-        m_window.draw(healthGlow);
-
-        // Texte de la vie (petit, élégant)
-        sf::Text healthText(m_font, std::to_string(m_player->getHealth()) + " / " + std::to_string(m_player->getMaxHealth()), 14);
-        healthText.setPosition(sf::Vector2f(barX + barWidth + 10.0f, barY - 2.0f));
-        healthText.setFillColor(sf::Color::White);
-        m_window.draw(healthText);
-    }
-
-    // Afficher le titre du jeu si on est au niveau prologue (niveau 0)
-    if (m_currentLevelNumber == 0 && !m_isFinished && !m_isGameComplete) {
-        // Titre "BoooBee" en gros et en jaune
-        sf::Text titleText(m_font, "BoooBee", 140);
-        titleText.setFillColor(sf::Color(255, 215, 0)); // Jaune doré
-        titleText.setOutlineColor(sf::Color::White);
-        titleText.setOutlineThickness(6.0f);
-        titleText.setStyle(sf::Text::Bold);
-
-        sf::FloatRect titleBounds = titleText.getLocalBounds();
-        titleText.setOrigin(sf::Vector2f(titleBounds.position.x + titleBounds.size.x / 2.0f,
-                                          titleBounds.position.y + titleBounds.size.y / 2.0f));
-        titleText.setPosition(sf::Vector2f(640.0f, 120.0f)); // En haut au centre
-
-        // Halo lumineux rectangulaire qui prend toute la base du texte (comme si les lettres brillaient)
-        float textWidth = titleBounds.size.x;
-        float textHeight = titleBounds.size.y;
-
-        // Dessiner plusieurs rectangles avec opacité décroissante pour l'effet de lueur
-        for (int i = 6; i >= 1; --i) {
-            sf::RectangleShape glow(sf::Vector2f(textWidth + i * 30.0f, textHeight + i * 20.0f));
-            glow.setOrigin(sf::Vector2f((textWidth + i * 30.0f) / 2.0f, (textHeight + i * 20.0f) / 2.0f));
-            glow.setPosition(sf::Vector2f(640.0f, 120.0f));
-            int alpha = 20 - i * 3; // Opacité décroissante
-            glow.setFillColor(sf::Color(255, 215, 0, alpha)); // Jaune doré avec transparence
-            m_window.draw(glow);
-        }
-
-        // Dessiner le titre par-dessus le halo
-        m_window.draw(titleText);
-    }
-
-    // Afficher "NOUVEAU POUVOIR" si on est au niveau 4 ou 8
-    if ((m_currentLevelNumber == 4 || m_currentLevelNumber == 8) && !m_isFinished && !m_isGameComplete) {
-        // Titre "NOUVEAU POUVOIR" en jaune (2 fois plus petit que le titre principal)
-        sf::Text powerText(m_font, "NOUVEAU POUVOIR", 70);
-        powerText.setFillColor(sf::Color(255, 215, 0)); // Jaune doré
-        powerText.setOutlineColor(sf::Color::White);
-        powerText.setOutlineThickness(3.0f);
-        powerText.setStyle(sf::Text::Bold);
-
-        sf::FloatRect powerBounds = powerText.getLocalBounds();
-        powerText.setOrigin(sf::Vector2f(powerBounds.position.x + powerBounds.size.x / 2.0f,
-                                          powerBounds.position.y + powerBounds.size.y / 2.0f));
-        powerText.setPosition(sf::Vector2f(640.0f, 120.0f)); // En haut au centre
-
-        // Halo lumineux rectangulaire
-        float textWidth = powerBounds.size.x;
-        float textHeight = powerBounds.size.y;
-
-        // Dessiner plusieurs rectangles avec opacité décroissante pour l'effet de lueur
-        for (int i = 4; i >= 1; --i) {
-            sf::RectangleShape glow(sf::Vector2f(textWidth + i * 15.0f, textHeight + i * 10.0f));
-            glow.setOrigin(sf::Vector2f((textWidth + i * 15.0f) / 2.0f, (textHeight + i * 10.0f) / 2.0f));
-            glow.setPosition(sf::Vector2f(640.0f, 120.0f));
-            int alpha = 20 - i * 3; // Opacité décroissante
-            glow.setFillColor(sf::Color(255, 215, 0, alpha)); // Jaune doré avec transparence
-            m_window.draw(glow);
+    ProfileScope hudScope(ProfileStage::Hud);
+
+    // HUD retenu: recomposé seulement quand la vie, la bannière ou le message changent
+    Hud::Banner banner = Hud::Banner::None;
+    if (!m_isFinished && !m_isGameComplete) {
+        if (m_currentLevelNumber == 0) {
+            banner = Hud::Banner::Title;            // Titre du jeu au prologue
+        } else if (m_currentLevelNumber == 4) {
+            banner = Hud::Banner::DoubleJump;       // Nouveau pouvoir
+        } else if (m_currentLevelNumber == 8) {
+            banner = Hud::Banner::HeroCharge;
         }
-
-        // Dessiner le texte par-dessus le halo
-        m_window.draw(powerText);
-
-        // Sous-titre indiquant le pouvoir spécifique
-        std::string powerName = (m_currentLevelNumber == 4) ? "Double Saut (Espace)" : "Charge du Heros (Shift Droit)";
-        sf::Text subText(m_font, powerName, 30);
-        subText.setFillColor(sf::Color(255, 255, 200));
-        subText.setOutlineColor(sf::Color(100, 80, 0));
-        subText.setOutlineThickness(2.0f);
-
-        sf::FloatRect subBounds = subText.getLocalBounds();
-        subText.setOrigin(sf::Vector2f(subBounds.position.x + subBounds.size.x / 2.0f,
-                                        subBounds.position.y + subBounds.size.y / 2.0f));
-        subText.setPosition(sf::Vector2f(640.0f, 170.0f));
-        m_window.draw(subText);
     }
-
-    // Afficher le message de victoire si le niveau est terminé
-    if (m_isFinished && !m_isGameComplete) {
-        showVictoryMessage();
+    m_hud->setHealth(m_player->getHealth(), m_player->getMaxHealth());
+    m_hud->setBanner(banner);
+    m_hud->setLevelComplete(m_isFinished && !m_isGameComplete);
+    m_hud->render(m_window);
+
+    // Statistiques de culling du dernier rendu (F3)
+    if (m_showRenderStats) {
+        const Level::RenderStats& stats = m_level->getRenderStats();
+        sf::Text statsText(*m_font,
+            "Culling: objets " + std::to_string(stats.drawn) + " dessines / " + std::to_string(stats.culled) +
+            " ignores | chunks " + std::to_string(stats.drawnChunks) + " / " + std::to_string(stats.culledChunks) +
+            " | HUD recompose " + std::to_string(m_hud->getRebuildCount()) + " fois", 14);
+        statsText.setPosition(sf::Vector2f(20.0f, 45.0f));
+        statsText.setFillColor(sf::Color(200, 255, 200));
+        m_window.draw(statsText);
     }
 
     // Afficher le menu de game over si le joueur est mort
@@ -562,29 +619,13 @@ void Game::render() {
         showLevelSelectMenu();
     }
 
-    m_window.display();
-}
-
-void Game::showVictoryMessage() {
-    // Rectangle semi-transparent en arrière-plan
-    sf::RectangleShape overlay(sf::Vector2f(1280.0f, 720.0f));
-    overlay.setFillColor(sf::Color(0, 0, 0, 180));
-    m_window.draw(overlay);
-
-    // Texte "Niveau Terminé" (SFML 3.0 nécessite la font dans le constructeur)
-    sf::Text finishText(m_font, "Niveau Termine !", 120);
-    finishText.setFillColor(sf::Color(255, 215, 0)); // Or
-    finishText.setOutlineColor(sf::Color::White);
-    finishText.setOutlineThickness(5.0f);
-    finishText.setStyle(sf::Text::Bold);
+    hudScope.stop();
 
-    // Centrer le texte
-    sf::FloatRect textBounds = finishText.getLocalBounds();
-    finishText.setOrigin(sf::Vector2f(textBounds.position.x + textBounds.size.x / 2.0f,
-                                       textBounds.position.y + textBounds.size.y / 2.0f));
-    finishText.setPosition(sf::Vector2f(640.0f, 360.0f));
+    // Overlay du profileur (F4), par-dessus tout le reste
+    FrameProfiler::getInstance().render(m_window, *m_font);
 
-    m_window.draw(finishText);
+    ProfileScope displayScope(ProfileStage::Display);
+    m_window.display();
 }
 
 void Game::handlePlayerInput(sf::Keyboard::Key key, bool isPressed) {
@@ -613,6 +654,49 @@ void Game::handleMenuInput(sf::Keyboard::Key key) {
     }
 }
 
+void Game::startPreload(int levelNumber) {
+    // Créé ici (textures partagées, aucune lecture de fichier), rempli par le thread de chargement
+    std::unique_ptr<Level> level = Level::createForPreload(*m_level);
+    m_preloadLevelNumber = levelNumber;
+    m_preload = std::async(std::launch::async, [level = std::move(level), levelNumber]() mutable {
+        return prepareLevel(std::move(level), levelNumber);
+    });
+}
+
+void Game::cancelPreload() {
+    // Le thread de chargement tire dans les flux Level, Ambient et Enemies du générateur partagé:
+    // attendre sa fin avant toute génération sur ce thread, et jeter son résultat
+    if (m_preload.valid()) {
+        m_preload.wait();
+        m_preload = std::future<PreparedLevel>();
+    }
+    m_preloadLevelNumber = -1;
+}
+
+Game::PreparedLevel Game::prepareLevel(std::unique_ptr<Level> level, int levelNumber) {
+    PreparedLevel prepared;
+
+    // Vérifier si le niveau suivant existe et est valide
+    prepared.valid = Level::isLevelValid(levelNumber);
+    std::cout << "Level " << levelNumber << " is valid: " << (prepared.valid ? "YES" : "NO") << std::endl;
+    if (!prepared.valid) {
+        return prepared;
+    }
+
+    std::string filename = "levels/level_" + std::to_string(levelNumber) + ".json";
+    std::cout << "Loading file: " << filename << std::endl;
+    if (!level->loadFromFile(filename)) {
+        std::cout << "ERROR: Failed to load file " << filename << std::endl;
+        return prepared;
+    }
+
+    // Générer les ennemis pour ce niveau (à partir du niveau 5)
+    level->generateEnemies(levelNumber);
+
+    prepared.level = std::move(level);
+    return prepared;
+}
+
 void Game::loadNextLevel() {
     int nextLevel = m_currentLevelNumber + 1;
 
@@ -620,22 +704,36 @@ void Game::loadNextLevel() {
     std::cout << "Current level: " << m_currentLevelNumber << std::endl;
     std::cout << "Trying to load level " << nextLevel << "..." << std::endl;
 
-    // Vérifier si le niveau suivant existe et est valide
-    bool isValid = Level::isLevelValid(nextLevel);
-    std::cout << "Level " << nextLevel << " is valid: " << (isValid ? "YES" : "NO") << std::endl;
-
-    if (isValid) {
-        std::string filename = "levels/level_" + std::to_string(nextLevel) + ".json";
-        std::cout << "Loading file: " << filename << std::endl;
+    // Niveau préparé pendant la transition (en général déjà prêt: pas d'attente),
+    // sinon préparation immédiate sur ce thread
+    PreparedLevel prepared;
+    bool preloaded = false;
+    if (m_preload.valid()) {
+        PreparedLevel result = m_preload.get();
+        preloaded = m_preloadLevelNumber == nextLevel;
+        if (preloaded) {
+            prepared = std::move(result);
+        }
+    }
+    if (!preloaded) {
+        prepared = prepareLevel(Level::createForPreload(*m_level), nextLevel);
+    }
 
-        if (m_level->loadFromFile(filename)) {
+    if (prepared.valid) {
+        if (prepared.level) {
             std::cout << "File loaded successfully!" << std::endl;
+
+            // Échange de pointeurs; le nouveau niveau envoie sa géométrie au GPU et garde le backend des tiles
+            Tilemap::RenderMode renderMode = m_level->getTilemap().getRenderMode();
+            m_level.swap(prepared.level);
+            m_level->finishPreload();
+            if (renderMode != Tilemap::RenderMode::Chunks) {
+                m_level->getTilemap().setRenderMode(renderMode);
+            }
+
             m_currentLevelNumber = nextLevel;
             m_isFinished = false;
 
-            // Générer les ennemis pour ce niveau (à partir du niveau 5)
-            m_level->generateEnemies(nextLevel);
-
             // Niveau 4 : activer le double saut
             if (nextLevel == 4) {
                 m_player->unlockDoubleJump();
@@ -657,12 +755,11 @@ void Game::loadNextLevel() {
                 playerStartPos.y = portalPos.y + 32.0f - 51.0f;  // Centre du portail - moitié hauteur joueur
                 m_player->setPosition(playerStartPos);
                 m_camera->setPosition(playerStartPos);
+                m_player->saveInterpolationState();  // Téléportation: pas d'interpolation
                 std::cout << "Level " << nextLevel << " loaded successfully! Player positioned at portal." << std::endl;
             } else {
                 std::cout << "ERROR: No entrance portal found!" << std::endl;
             }
-        } else {
-            std::cout << "ERROR: Failed to load file " << filename << std::endl;
         }
     } else {
         // Pas de niveau suivant valide, le jeu est terminé
@@ -687,7 +784,8 @@ void Game::restartGame() {
     m_player->resetDisintegration();
     m_player->lockDoubleJump();  // Retour au prologue = pas de pouvoirs
 
-    // Charger le niveau prologue
+    // Charger le niveau prologue (après le thread de préchargement: mêmes flux aléatoires)
+    cancelPreload();
     if (m_level->loadFromFile("levels/prologue.json")) {
         // Générer les ennemis pour le prologue (aucun car niveau 0)
         m_level->generateEnemies(0);
@@ -701,6 +799,7 @@ void Game::restartGame() {
             m_player->setPosition(playerStartPos);
             m_player->setVelocity(sf::Vector2f(0.0f, 0.0f));
             m_camera->setPosition(playerStartPos);
+            m_player->saveInterpolationState();  // Téléportation: pas d'interpolation
             std::cout << "Game restarted successfully!" << std::endl;
         }
     }
@@ -713,11 +812,10 @@ void Game::showFinalVictoryMenu() {
     m_window.draw(overlay);
 
     // Titre "FELICITATIONS!"
-    sf::Text titleText(m_font, "FELICITATIONS !", 100);
+    SdfText titleText(*m_titleFont, "FELICITATIONS !", 100);
     titleText.setFillColor(sf::Color(255, 215, 0));
     titleText.setOutlineColor(sf::Color::White);
     titleText.setOutlineThickness(5.0f);
-    titleText.setStyle(sf::Text::Bold);
 
     sf::FloatRect titleBounds = titleText.getLocalBounds();
     titleText.setOrigin(sf::Vector2f(titleBounds.position.x + titleBounds.size.x / 2.0f,
@@ -726,7 +824,7 @@ void Game::showFinalVictoryMenu() {
     m_window.draw(titleText);
 
     // Message "Jeu termine!"
-    sf::Text messageText(m_font, "Vous avez termine tous les niveaux !", 40);
+    sf::Text messageText(*m_font, "Vous avez termine tous les niveaux !", 40);
     messageText.setFillColor(sf::Color::White);
 
     sf::FloatRect messageBounds = messageText.getLocalBounds();
@@ -743,7 +841,7 @@ void Game::showFinalVictoryMenu() {
     restartButton.setOutlineThickness(3.0f);
     m_window.draw(restartButton);
 
-    sf::Text restartText(m_font, "Recommencer (ENTREE)", 24);
+    sf::Text restartText(*m_font, "Recommencer (ENTREE)", 24);
     restartText.setFillColor(sf::Color::White);
     restartText.setPosition(sf::Vector2f(520.0f, 465.0f));
     m_window.draw(restartText);
@@ -756,7 +854,7 @@ void Game::showFinalVictoryMenu() {
     quitButton.setOutlineThickness(3.0f);
     m_window.draw(quitButton);
 
-    sf::Text quitText(m_font, "Quitter (ECHAP)", 24);
+    sf::Text quitText(*m_font, "Quitter (ECHAP)", 24);
     quitText.setFillColor(sf::Color::White);
     quitText.setPosition(sf::Vector2f(545.0f, 555.0f));
     m_window.draw(quitText);
@@ -769,11 +867,10 @@ void Game::showGameOverMenu() {
     m_window.draw(overlay);
 
     // Titre "VOUS ETES MORT !!"
-    sf::Text titleText(m_font, "VOUS ETES MORT !!", 100);
+    SdfText titleText(*m_titleFont, "VOUS ETES MORT !!", 100);
     titleText.setFillColor(sf::Color(255, 50, 50));
     titleText.setOutlineColor(sf::Color(150, 0, 0));
     titleText.setOutlineThickness(5.0f);
-    titleText.setStyle(sf::Text::Bold);
 
     sf::FloatRect titleBounds = titleText.getLocalBounds();
     titleText.setOrigin(sf::Vector2f(titleBounds.position.x + titleBounds.size.x / 2.0f,
@@ -782,7 +879,7 @@ void Game::showGameOverMenu() {
     m_window.draw(titleText);
 
     // Message "Partie terminée"
-    sf::Text messageText(m_font, "Partie terminee", 40);
+    sf::Text messageText(*m_font, "Partie terminee", 40);
     messageText.setFillColor(sf::Color(200, 200, 200));
 
     sf::FloatRect messageBounds = messageText.getLocalBounds();
@@ -799,7 +896,7 @@ void Game::showGameOverMenu() {
     restartButton.setOutlineThickness(3.0f);
     m_window.draw(restartButton);
 
-    sf::Text restartText(m_font, "Recommencer (ENTREE)", 24);
+    sf::Text restartText(*m_font, "Recommencer (ENTREE)", 24);
     restartText.setFillColor(sf::Color::White);
     restartText.setPosition(sf::Vector2f(520.0f, 465.0f));
     m_window.draw(restartText);
@@ -812,7 +909,7 @@ void Game::showGameOverMenu() {
     quitButton.setOutlineThickness(3.0f);
     m_window.draw(quitButton);
 
-    sf::Text quitText(m_font, "Quitter (ECHAP)", 24);
+    sf::Text quitText(*m_font, "Quitter (ECHAP)", 24);
     quitText.setFillColor(sf::Color::White);
     quitText.setPosition(sf::Vector2f(545.0f, 555.0f));
     m_window.draw(quitText);
@@ -825,7 +922,7 @@ void Game::showLevelSelectMenu() {
     m_window.draw(overlay);
 
     // Titre
-    sf::Text title(m_font, "SELECTION DE NIVEAU (DEV)", 48);
+    sf::Text title(*m_font, "SELECTION DE NIVEAU (DEV)", 48);
     title.setFillColor(sf::Color(255, 215, 0));
     title.setOutlineColor(sf::Color::White);
     title.setOutlineThickness(2.0f);
@@ -835,7 +932,7 @@ void Game::showLevelSelectMenu() {
     m_window.draw(title);
 
     // Instructions
-    sf::Text instructions(m_font, "<- -> : Naviguer | ENTREE : Charger | CTRL+L : Fermer", 20);
+    sf::Text instructions(*m_font, "<- -> : Naviguer | ENTREE : Charger | CTRL+L : Fermer", 20);
     instructions.setFillColor(sf::Color::White);
     sf::FloatRect instrBounds = instructions.getLocalBounds();
     instructions.setPosition(sf::Vector2f(640.0f - (instrBounds.position.x + instrBounds.size.x) / 2.0f, 640.0f));
@@ -875,7 +972,7 @@ void Game::showLevelSelectMenu() {
 
         // Texte du niveau
         std::string levelText = (level == 0) ? "PROLOGUE" : "NIVEAU " + std::to_string(level);
-        sf::Text text(m_font, levelText, 18);
+        sf::Text text(*m_font, levelText, 18);
         text.setFillColor(sf::Color::White);
         text.setStyle(sf::Text::Bold);
         sf::FloatRect textBounds = text.getLocalBounds();
@@ -885,7 +982,7 @@ void Game::showLevelSelectMenu() {
 
         // Indicateur du niveau actuel
         if (level == m_currentLevelNumber) {
-            sf::Text currentIndicator(m_font, "(ACTUEL)", 14);
+            sf::Text currentIndicator(*m_font, "(ACTUEL)", 14);
             currentIndicator.setFillColor(sf::Color::Green);
             sf::FloatRect currentBounds = currentIndicator.getLocalBounds();
             currentIndicator.setPosition(sf::Vector2f(x + buttonWidth / 2.0f - (currentBounds.position.x + currentBounds.size.x) / 2.0f,
@@ -902,7 +999,9 @@ void Game::loadLevel(int levelNumber) {
         return;
     }
 
-    // Charger le nouveau niveau dans l'objet existant (pour garder le tileset)
+    // Charger le nouveau niveau dans l'objet existant (pour garder le tileset),
+    // après le thread de préchargement: mêmes flux aléatoires
+    cancelPreload();
     std::string levelPath = (levelNumber == 0) ? "levels/prologue.json" :
                             "levels/level_" + std::to_string(levelNumber) + ".json";
 
@@ -944,6 +1043,7 @@ void Game::loadLevel(int levelNumber) {
         m_player->setPosition(playerStartPos);
         m_player->setVelocity(sf::Vector2f(0.0f, 0.0f));
         m_camera->setPosition(playerStartPos);
+        m_player->saveInterpolationState();  // Téléportation: pas d'interpolation
     }
 
     // Réinitialiser les états du jeu
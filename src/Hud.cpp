@@ -0,0 +1,201 @@
+#include "Hud.hpp"
+#include <iostream>
+#include <string>
+
+namespace {
+    const float BAR_X = 20.0f;
+    const float BAR_Y = 20.0f;
+    const float BAR_WIDTH = 200.0f;
+    const float BAR_HEIGHT = 15.0f;
+
+    const sf::Color GOLD(255, 215, 0);  // Jaune doré
+
+    template <typename TextT>
+    void centerOrigin(TextT& text) {
+        sf::FloatRect bounds = text.getLocalBounds();
+        text.setOrigin(sf::Vector2f(bounds.position.x + bounds.size.x / 2.0f,
+                                    bounds.position.y + bounds.size.y / 2.0f));
+    }
+
+    // Rectangles d'opacité décroissante autour du texte (comme si les lettres brillaient)
+    std::vector<sf::RectangleShape> makeGlow(const SdfText& text, int layers, float stepX, float stepY) {
+        sf::FloatRect bounds = text.getLocalBounds();
+        std::vector<sf::RectangleShape> glow;
+        for (int i = layers; i >= 1; --i) {
+            sf::Vector2f size(bounds.size.x + i * stepX, bounds.size.y + i * stepY);
+            sf::RectangleShape rect(size);
+            rect.setOrigin(size / 2.0f);
+            rect.setPosition(text.getPosition());
+            rect.setFillColor(sf::Color(GOLD.r, GOLD.g, GOLD.b, static_cast<std::uint8_t>(20 - i * 3)));
+            glow.push_back(rect);
+        }
+        return glow;
+    }
+}
+
+Hud::Hud(std::shared_ptr<sf::Font> font, std::shared_ptr<SdfFont> titleFont, sf::Vector2u size)
+    : m_font(std::move(font))
+    , m_titleFont(std::move(titleFont))
+    , m_dirty(true)
+    , m_rebuildCount(0)
+    , m_health(0)
+    , m_maxHealth(1)
+    , m_banner(Banner::None)
+    , m_levelComplete(false)
+{
+    if (!m_layer.resize(size)) {
+        std::cerr << "✗ Failed to create HUD render texture" << std::endl;
+    }
+    m_layerSprite = std::make_unique<sf::Sprite>(m_layer.getTexture());
+
+    buildHealthBar();
+    buildBanners();
+    buildLevelComplete();
+}
+
+void Hud::buildHealthBar() {
+    // Fond de la barre (gris foncé)
+    m_healthBackground.setSize(sf::Vector2f(BAR_WIDTH, BAR_HEIGHT));
+    m_healthBackground.setPosition(sf::Vector2f(BAR_X, BAR_Y));
+    m_healthBackground.setFillColor(sf::Color(40, 40, 40));
+    m_healthBackground.setOutlineColor(sf::Color(200, 200, 200));
+    m_healthBackground.setOutlineThickness(2.0f);
+
+    m_healthBar.setPosition(sf::Vector2f(BAR_X, BAR_Y));
+
+    // Effet de lueur sur la barre
+    m_healthGlow.setPosition(sf::Vector2f(BAR_X, BAR_Y));
+    m_healthGlow.setFillColor(sf::Color(255, 255, 255, 50));
+
+    // Texte de la vie (petit, élégant)
+    m_healthText = std::make_unique<sf::Text>(*m_font, "", 14);
+    m_healthText->setPosition(sf::Vector2f(BAR_X + BAR_WIDTH + 10.0f, BAR_Y - 2.0f));
+    m_healthText->setFillColor(sf::Color::White);
+}
+
+void Hud::buildBanners() {
+    // Titre "BoooBee" en gros et en jaune, en haut au centre
+    m_titleText = std::make_unique<SdfText>(*m_titleFont, "BoooBee", 140);
+    m_titleText->setFillColor(GOLD);
+    m_titleText->setOutlineColor(sf::Color::White);
+    m_titleText->setOutlineThickness(6.0f);
+    centerOrigin(*m_titleText);
+    m_titleText->setPosition(sf::Vector2f(640.0f, 120.0f));
+    m_titleGlow = makeGlow(*m_titleText, 6, 30.0f, 20.0f);
+
+    // "NOUVEAU POUVOIR" (2 fois plus petit que le titre principal)
+    m_powerText = std::make_unique<SdfText>(*m_titleFont, "NOUVEAU POUVOIR", 70);
+    m_powerText->setFillColor(GOLD);
+    m_powerText->setOutlineColor(sf::Color::White);
+    m_powerText->setOutlineThickness(3.0f);
+    centerOrigin(*m_powerText);
+    m_powerText->setPosition(sf::Vector2f(640.0f, 120.0f));
+    m_powerGlow = makeGlow(*m_powerText, 4, 15.0f, 10.0f);
+
+    // Sous-titre indiquant le pouvoir spécifique (texte choisi par setBanner)
+    m_powerSubText = std::make_unique<sf::Text>(*m_font, "", 30);
+    m_powerSubText->setFillColor(sf::Color(255, 255, 200));
+    m_powerSubText->setOutlineColor(sf::Color(100, 80, 0));
+    m_powerSubText->setOutlineThickness(2.0f);
+    m_powerSubText->setPosition(sf::Vector2f(640.0f, 170.0f));
+}
+
+void Hud::buildLevelComplete() {
+    // Rectangle semi-transparent en arrière-plan
+    m_overlay.setSize(sf::Vector2f(m_layer.getSize()));
+    m_overlay.setFillColor(sf::Color(0, 0, 0, 180));
+
+    m_finishText = std::make_unique<SdfText>(*m_titleFont, "Niveau Termine !", 120);
+    m_finishText->setFillColor(GOLD);
+    m_finishText->setOutlineColor(sf::Color::White);
+    m_finishText->setOutlineThickness(5.0f);
+    centerOrigin(*m_finishText);
+    m_finishText->setPosition(sf::Vector2f(640.0f, 360.0f));
+}
+
+void Hud::setHealth(int health, int maxHealth) {
+    if (health == m_health && maxHealth == m_maxHealth) return;
+    m_health = health;
+    m_maxHealth = maxHealth;
+    m_dirty = true;
+}
+
+void Hud::setBanner(Banner banner) {
+    if (banner == m_banner) return;
+    m_banner = banner;
+
+    if (banner == Banner::DoubleJump || banner == Banner::HeroCharge) {
+        m_powerSubText->setString(banner == Banner::DoubleJump ? "Double Saut (Espace)" : "Charge du Heros (Shift Droit)");
+        centerOrigin(*m_powerSubText);
+    }
+    m_dirty = true;
+}
+
+void Hud::setLevelComplete(bool complete) {
+    if (complete == m_levelComplete) return;
+    m_levelComplete = complete;
+    m_dirty = true;
+}
+
+void Hud::updateHealthBar() {
+    float healthRatio = static_cast<float>(m_health) / static_cast<float>(m_maxHealth);
+    sf::Vector2f barSize(BAR_WIDTH * healthRatio, BAR_HEIGHT);
+
+    // Couleur en fonction de la vie restante
+    sf::Color healthColor;
+    if (healthRatio > 0.6f) {
+        healthColor = sf::Color(50, 200, 50); // Vert
+    } else if (healthRatio > 0.3f) {
+        healthColor = sf::Color(255, 200, 0); // Orange
+    } else {
+        healthColor = sf::Color(220, 50, 50); // Rouge
+    }
+
+    m_healthBar.setSize(barSize);
+    m_healthBar.setFillColor(healthColor);
+    m_healthGlow.setSize(barSize);
+    m_healthText->setString(std::to_string(m_health) + " / " + std::to_string(m_maxHealth));
+}
+
+void Hud::rebuild() {
+    updateHealthBar();
+
+    m_layer.clear(sf::Color::Transparent);
+
+    m_layer.draw(m_healthBackground);
+    m_layer.draw(m_healthBar);
+    m_layer.draw(m_healthGlow);
+    m_layer.draw(*m_healthText);
+
+    if (m_banner == Banner::Title) {
+        for (const auto& glow : m_titleGlow) {
+            m_layer.draw(glow);
+        }
+        m_layer.draw(*m_titleText);
+    } else if (m_banner != Banner::None) {
+        for (const auto& glow : m_powerGlow) {
+            m_layer.draw(glow);
+        }
+        m_layer.draw(*m_powerText);
+        m_layer.draw(*m_powerSubText);
+    }
+
+    if (m_levelComplete) {
+        m_layer.draw(m_overlay);
+        m_layer.draw(*m_finishText);
+    }
+
+    m_layer.display();
+    m_dirty = false;
+    ++m_rebuildCount;
+}
+
+void Hud::render(sf::RenderTarget& target) {
+    if (m_dirty) {
+        rebuild();
+    }
+
+    // Couleurs déjà multipliées par l'alpha dans la RenderTexture: ne pas les multiplier une seconde fois
+    static const sf::BlendMode premultipliedAlpha(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+    target.draw(*m_layerSprite, sf::RenderStates(premultipliedAlpha));
+}
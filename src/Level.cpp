@@ -1,12 +1,20 @@
 #include "Level.hpp"
+#include "AssetLoader.hpp"
+#include "FastMath.hpp"
+#include "FrameProfiler.hpp"
+#include "LevelFile.hpp"
+#include "Random.hpp"
+#include "TileCollision.hpp"
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <algorithm>
 #include <cmath>
-#include <random>
 
-Level::Level()
+Level::Level(bool headless)
+    : Level(headless, nullptr)
+{
+}
+
+Level::Level(bool headless, const Level* resources)
     : m_tilemap(std::make_unique<Tilemap>(64))  // Chaque tile fait 64x64 pixels à l'écran (256*0.25)
     , m_finishLine(sf::Vector2f(0, 0), sf::Vector2f(0, 0))
     , m_entrancePortalPosition(0.0f, 0.0f)
@@ -15,26 +23,55 @@ Level::Level()
     , m_hasExitPortal(false)
     , m_doorTextureLoaded(false)
     , m_isPrologueLevel(false)
+    , m_headless(headless)
     , m_ambientTimer(0.0f)
 {
-    // Charger la texture de la porte médiévale (taille moyenne - 1.5x hauteur joueur)
-    if (m_doorTexture.loadFromFile("assets/tiles/Medieval_door_medium.png")) {
-        m_doorTextureLoaded = true;
-        m_entranceDoorSprite = std::make_unique<sf::Sprite>(m_doorTexture);
-        m_exitDoorSprite = std::make_unique<sf::Sprite>(m_doorTexture);
-        std::cout << "Medieval door texture loaded successfully" << std::endl;
-    } else {
-        std::cerr << "Failed to load medieval door texture" << std::endl;
+    m_tilemap->setHeadless(headless);
+    if (headless) return;
+
+    // Niveau principal: textures demandées par requestAssets()
+    if (resources) {
+        // Textures déjà chargées par le niveau courant; la géométrie attend finishPreload()
+        m_tilemap->shareTileset(*resources->m_tilemap);
+        m_tilemap->setDeferredUpload(true);
+        setDoorTexture(resources->m_doorTexture);
     }
 }
 
-bool Level::load() {
+void Level::requestAssets(AssetLoader& loader) {
     // Charger le tileset Mossy
-    if (!m_tilemap->loadFromFile("assets/tiles/Mossy Tileset/Mossy - TileSet.png")) {
-        return false;
+    loader.loadTexture("assets/tiles/Mossy Tileset/Mossy - TileSet.png",
+        [this](const std::shared_ptr<sf::Texture>& texture, const CookedAssets::Entry& source) {
+            m_tilemap->setTileset(texture, source);
+        }, true);
+
+    // Charger la texture de la porte médiévale (taille moyenne - 1.5x hauteur joueur)
+    loader.loadTexture("assets/tiles/Medieval_door_medium.png",
+        [this](const std::shared_ptr<sf::Texture>& texture, const CookedAssets::Entry&) {
+            setDoorTexture(texture);
+            std::cout << "Medieval door texture loaded successfully" << std::endl;
+        });
+}
+
+void Level::setDoorTexture(std::shared_ptr<sf::Texture> texture) {
+    m_doorTexture = std::move(texture);
+    if (m_doorTexture) {
+        m_doorTextureLoaded = true;
+        m_entranceDoorSprite = std::make_unique<sf::Sprite>(*m_doorTexture);
+        m_exitDoorSprite = std::make_unique<sf::Sprite>(*m_doorTexture);
     }
+}
+
+std::unique_ptr<Level> Level::createForPreload(const Level& resources) {
+    return std::unique_ptr<Level>(new Level(resources.m_headless, &resources));
+}
+
+void Level::finishPreload() {
+    m_tilemap->uploadDeferred();
+}
 
-    // Charger le niveau prologue
+bool Level::load() {
+    // Charger le niveau prologue (tileset et porte: voir requestAssets)
     bool success = loadFromFile("levels/prologue.json");
     if (success) {
         // Générer les ennemis pour le prologue (aucun car niveau 0)
@@ -49,158 +86,63 @@ bool Level::loadFromFile(const std::string& filepath) {
     // Détecter si c'est le niveau prologue
     m_isPrologueLevel = (filepath.find("prologue") != std::string::npos);
 
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open level file: " << filepath << std::endl;
+    // Version binaire (.bblv) si elle est à jour, sinon le JSON
+    LevelData data;
+    if (!LevelFile::load(filepath, data)) {
         return false;
     }
 
-    // Lecture simple du JSON ligne par ligne
-    std::string line;
-    std::vector<std::vector<int>> levelData;
-    int width = 0, height = 0;
-    bool inTiles = false;
-    bool inRow = false;
+    if (data.entrance.present) {
+        m_entrancePortalPosition = sf::Vector2f(data.entrance.x * 64.0f, data.entrance.y * 64.0f);
+        m_hasEntrancePortal = true;
 
-    while (std::getline(file, line)) {
-        // Enlever les espaces
-        line.erase(std::remove_if(line.begin(), line.end(), ::isspace), line.end());
-
-        if (line.find("\"width\":") != std::string::npos) {
-            size_t pos = line.find(":");
-            width = std::stoi(line.substr(pos + 1, line.find(",") - pos - 1));
-            std::cout << "Parsed width: " << width << std::endl;
-        }
-        else if (line.find("\"height\":") != std::string::npos) {
-            size_t pos = line.find(":");
-            height = std::stoi(line.substr(pos + 1, line.find(",") - pos - 1));
-            std::cout << "Parsed height: " << height << std::endl;
+        // Positionner le sprite de la porte d'entrée
+        if (m_doorTextureLoaded && m_entranceDoorSprite) {
+            // Positionner la porte pour qu'elle soit sur le sol
+            // La porte fait 156 pixels de haut (taille moyenne), on la place au-dessus du portail
+            float doorX = data.entrance.x * 64.0f + 32.0f - 39.0f;  // Centrer horizontalement (78/2 = 39 pixels)
+            float doorY = data.entrance.y * 64.0f - 156.0f + 64.0f;  // Placer au-dessus du sol (hauteur 156)
+            m_entranceDoorSprite->setPosition(sf::Vector2f(doorX, doorY));
         }
-        else if (line.find("\"tiles\":") != std::string::npos) {
-            inTiles = true;
-            std::cout << "Found tiles array" << std::endl;
-        }
-        else if (inTiles && line.find("[") == 0) {
-            // C'est une ligne de tiles (peut avoir une virgule à la fin)
-            std::vector<int> row;
 
-            // Enlever le [ au début
-            std::string content = line.substr(1);
+        std::cout << "Entrance portal found at: (" << data.entrance.x << ", " << data.entrance.y << ")" << std::endl;
+    }
 
-            // Enlever le ] et possiblement une virgule à la fin
-            size_t endPos = content.find_last_of("]");
-            if (endPos != std::string::npos) {
-                content = content.substr(0, endPos);
-            }
+    if (data.exit.present) {
+        m_exitPortalPosition = sf::Vector2f(data.exit.x * 64.0f, data.exit.y * 64.0f);
+        m_hasExitPortal = true;
 
-            if (!content.empty()) {
-                std::stringstream ss(content);
-                std::string token;
-                while (std::getline(ss, token, ',')) {
-                    row.push_back(std::stoi(token));
-                }
-                levelData.push_back(row);
-                std::cout << "Parsed row " << levelData.size() << " with " << row.size() << " tiles" << std::endl;
-            }
-        }
-        else if (line.find("],") == 0 || line.find("]") == 0) {
-            inTiles = false;
-            std::cout << "End of tiles array, parsed " << levelData.size() << " rows" << std::endl;
+        // Positionner le sprite de la porte de sortie
+        if (m_doorTextureLoaded && m_exitDoorSprite) {
+            float doorX = data.exit.x * 64.0f + 32.0f - 39.0f;
+            float doorY = data.exit.y * 64.0f - 156.0f + 64.0f;
+            m_exitDoorSprite->setPosition(sf::Vector2f(doorX, doorY));
         }
-        else if (line.find("\"entrancePortal\":{") != std::string::npos) {
-            // Parser le portail d'entrée
-            size_t xPos = line.find("\"x\":");
-            size_t yPos = line.find("\"y\":");
-            if (xPos != std::string::npos && yPos != std::string::npos) {
-                int x = std::stoi(line.substr(xPos + 4, line.find(",", xPos) - xPos - 4));
-                int y = std::stoi(line.substr(yPos + 4, line.find("}", yPos) - yPos - 4));
-                m_entrancePortalPosition = sf::Vector2f(x * 64.0f, y * 64.0f);
-                m_hasEntrancePortal = true;
-
-                // Positionner le sprite de la porte d'entrée
-                if (m_doorTextureLoaded && m_entranceDoorSprite) {
-                    // Positionner la porte pour qu'elle soit sur le sol
-                    // La porte fait 156 pixels de haut (taille moyenne), on la place au-dessus du portail
-                    float doorX = x * 64.0f + 32.0f - 39.0f;  // Centrer horizontalement (78/2 = 39 pixels)
-                    float doorY = y * 64.0f - 156.0f + 64.0f;  // Placer au-dessus du sol (hauteur 156)
-                    m_entranceDoorSprite->setPosition(sf::Vector2f(doorX, doorY));
-                }
 
-                std::cout << "Entrance portal found at: (" << x << ", " << y << ")" << std::endl;
-            }
-        }
-        else if (line.find("\"exitPortal\":{") != std::string::npos) {
-            // Parser le portail de sortie
-            size_t xPos = line.find("\"x\":");
-            size_t yPos = line.find("\"y\":");
-            if (xPos != std::string::npos && yPos != std::string::npos) {
-                int x = std::stoi(line.substr(xPos + 4, line.find(",", xPos) - xPos - 4));
-                int y = std::stoi(line.substr(yPos + 4, line.find("}", yPos) - yPos - 4));
-                m_exitPortalPosition = sf::Vector2f(x * 64.0f, y * 64.0f);
-                m_hasExitPortal = true;
-
-                // Positionner le sprite de la porte de sortie
-                if (m_doorTextureLoaded && m_exitDoorSprite) {
-                    // Positionner la porte pour qu'elle soit sur le sol
-                    // La porte fait 156 pixels de haut (taille moyenne), on la place au-dessus du portail
-                    float doorX = x * 64.0f + 32.0f - 39.0f;  // Centrer horizontalement (78/2 = 39 pixels)
-                    float doorY = y * 64.0f - 156.0f + 64.0f;  // Placer au-dessus du sol (hauteur 156)
-                    m_exitDoorSprite->setPosition(sf::Vector2f(doorX, doorY));
-                }
-
-                std::cout << "Exit portal found at: (" << x << ", " << y << ")" << std::endl;
-            }
-        }
-        else if (line.find("\"giantEnemy\"") != std::string::npos) {
-            // Parser l'ennemi géant (supporte les deux formats: avec ou sans espace avant {)
-            size_t xPos = line.find("\"x\":");
-            size_t yPos = line.find("\"y\":");
-            size_t scalePos = line.find("\"scale\":");
-            if (xPos != std::string::npos && yPos != std::string::npos) {
-                // Trouver la fin de la valeur x (virgule ou })
-                size_t xEnd = line.find(",", xPos);
-                if (xEnd == std::string::npos) xEnd = line.find("}", xPos);
-                int x = std::stoi(line.substr(xPos + 4, xEnd - xPos - 4));
-
-                // Trouver la fin de la valeur y (virgule ou })
-                size_t yEnd = line.find(",", yPos);
-                if (yEnd == std::string::npos) yEnd = line.find("}", yPos);
-                int y = std::stoi(line.substr(yPos + 4, yEnd - yPos - 4));
-
-                float scale = 1.0f;
-                if (scalePos != std::string::npos) {
-                    size_t scaleEnd = line.find("}", scalePos);
-                    scale = std::stof(line.substr(scalePos + 8, scaleEnd - scalePos - 8));
-                }
-
-                // Ajouter l'ennemi géant
-                sf::Vector2f enemyPos(x * 64.0f + 32.0f, y * 64.0f + 32.0f);
-                addEnemy(enemyPos, scale);
-                std::cout << "Giant enemy found at: (" << x << ", " << y << ") with scale " << scale << std::endl;
-            }
-        }
+        std::cout << "Exit portal found at: (" << data.exit.x << ", " << data.exit.y << ")" << std::endl;
     }
 
-    file.close();
-
-    if (levelData.empty()) {
-        std::cerr << "No level data found in file" << std::endl;
-        return false;
+    // Ennemis géants prédéfinis (les placements de l'éditeur ne sont pas utilisés en jeu)
+    for (const LevelData::GiantEnemyRecord& giant : data.giantEnemies) {
+        sf::Vector2f enemyPos(giant.x * 64.0f + 32.0f, giant.y * 64.0f + 32.0f);
+        addEnemy(enemyPos, giant.scale);
+        std::cout << "Giant enemy found at: (" << giant.x << ", " << giant.y << ") with scale " << giant.scale << std::endl;
     }
 
     // Charger les données dans la tilemap
-    m_tilemap->loadFromData(levelData, 14);  // 14 tiles par ligne dans le tileset
+    m_tilemap->loadFromData(data.tiles, data.width, data.height, 14);  // 14 tiles par ligne dans le tileset
+    m_enemies.setWorldBounds(sf::FloatRect(sf::Vector2f(0.0f, 0.0f), sf::Vector2f(data.width * 64.0f, data.height * 64.0f)));
 
     // Ligne d'arrivée à la fin du niveau
     m_finishLine = sf::FloatRect(
-        sf::Vector2f((width - 1) * 64.0f, 0),
-        sf::Vector2f(64.0f, 64.0f * height)
+        sf::Vector2f((data.width - 1) * 64.0f, 0),
+        sf::Vector2f(64.0f, 64.0f * data.height)
     );
 
     // Générer les particules ambiantes pour ce niveau
     generateAmbientParticles();
 
-    std::cout << "Level loaded successfully: " << width << "x" << height << std::endl;
+    std::cout << "Level loaded successfully: " << data.width << "x" << data.height << std::endl;
     return true;
 }
 
@@ -246,203 +188,81 @@ void Level::createSimpleLevel() {
 }
 
 void Level::update(sf::Time deltaTime, Player& player) {
-    handlePlayerCollision(player);
+    {
+        ProfileScope scope(ProfileStage::Collision);
+        handlePlayerCollision(player);
+    }
 
     // Mettre à jour les effets ambiants
-    updateAmbientEffects(deltaTime);
+    {
+        ProfileScope scope(ProfileStage::Ambient);
+        updateAmbientEffects(deltaTime);
+    }
 
     // Mettre à jour tous les ennemis
-    for (auto& enemy : m_enemies) {
-        if (enemy->isActive()) {
-            enemy->update(deltaTime, player);
-
-            // Vérifier si le joueur charge et touche l'ennemi
-            if (player.isCharging() && !enemy->isDying()) {
-                sf::FloatRect chargeBounds = player.getChargeBounds();
-                sf::FloatRect enemyBounds = enemy->getBounds();
-
-                if (chargeBounds.findIntersection(enemyBounds).has_value()) {
-                    // Déclencher l'animation de mort spectaculaire!
-                    enemy->triggerDeath();
-                    std::cout << "Enemy hit by Hero Charge! Death animation triggered!" << std::endl;
-                    continue;  // Passer à l'ennemi suivant
-                }
-            }
+    updateEnemies(deltaTime, player);
+}
 
-            // Vérifier la collision avec le joueur (seulement si pas en charge, pas en préparation, et pas en train de mourir)
-            if (!player.isCharging() && !player.isPreparingCharge() && !enemy->isDying() && enemy->checkCollision(player) && enemy->canDealDamage()) {
-                // Infliger 10% de dégâts (le joueur a 100 HP max)
-                player.takeDamage(10);
-                enemy->resetDamageCooldown();
-                std::cout << "Player hit by enemy! Health: " << player.getHealth() << "/" << player.getMaxHealth() << std::endl;
-            }
+void Level::updateEnemies(sf::Time deltaTime, Player& player) {
+    // Animation, explosions et poursuite du centre du joueur (moitié de sa taille)
+    m_enemies.update(deltaTime, player.getPosition() + sf::Vector2f(51.0f, 51.0f));
+
+    // Vérifier si le joueur charge et touche des ennemis
+    if (player.isCharging()) {
+        m_enemies.queryBodies(player.getChargeBounds(), m_nearbyEnemies);
+        for (int index : m_nearbyEnemies) {
+            // Déclencher l'animation de mort spectaculaire!
+            m_enemies.kill(index);
+            std::cout << "Enemy hit by Hero Charge! Death animation triggered!" << std::endl;
         }
+        return;
     }
-}
 
-void Level::handlePlayerCollision(Player& player) {
-    // Récupérer la position et la vélocité du joueur
-    sf::Vector2f position = player.getPosition();
-    sf::Vector2f velocity = player.getVelocity();
+    // Vérifier la collision avec le joueur (seulement si pas en charge ni en préparation)
+    if (player.isPreparingCharge()) return;
 
-    // Taille approximative du joueur (en se basant sur le sprite à l'échelle 0.2)
-    const float playerWidth = 102.0f;  // 512 * 0.2
-    const float playerHeight = 102.0f;
-    const float feetOffset = 25.0f;  // Les pieds sont à 25 pixels du bas du sprite
-
-    // Calculer les tiles autour du joueur
-    int tileSize = m_tilemap->getTileSize();  // 64
-
-    int leftTile = static_cast<int>(position.x / tileSize);
-    int rightTile = static_cast<int>((position.x + playerWidth) / tileSize);
-    int topTile = static_cast<int>(position.y / tileSize);
-    // Position des pieds réels du joueur
-    float feetY = position.y + playerHeight - feetOffset;
-    int bottomTile = static_cast<int>(feetY / tileSize);
-
-    // Debug
-    static int frameCount = 0;
-    if (frameCount % 60 == 0) {
-        std::cout << "Player Y: " << position.y << ", bottomTile: " << bottomTile
-                  << ", tileSize: " << tileSize << std::endl;
-    }
-    frameCount++;
-
-    // Vérifier collision horizontale avec les murs (en utilisant le centre du joueur)
-    float playerCenterX = position.x + playerWidth / 2.0f;
-    bool touchingWall = false;
-
-    for (int y = topTile; y < bottomTile; ++y) {
-        int centerTile = static_cast<int>(playerCenterX / tileSize);
-
-        // Vérifier si le joueur est adjacent à un mur (indépendamment de la vélocité)
-        if (m_tilemap->isSolid(centerTile, y)) {
-            // Récupérer la vraie bounding box de collision de cette tuile
-            sf::FloatRect wallBounds = m_tilemap->getTileCollisionBounds(centerTile, y);
-            float wallLeft = wallBounds.position.x;
-            float wallRight = wallBounds.position.x + wallBounds.size.x;
-
-            // Vérifier si le centre du joueur est dans le mur
-            if (playerCenterX >= wallLeft && playerCenterX <= wallRight) {
-                touchingWall = true;
-
-                // Appliquer la collision seulement si le joueur se déplace vers le mur
-                if (velocity.x < 0 && playerCenterX < wallRight) {
-                    // Collision à gauche
-                    position.x = wallRight - playerWidth / 2.0f;
-                    velocity.x = 0.0f;
-                    player.setPosition(position);
-                    player.setVelocity(velocity);
-
-                    // Recalculer les tiles
-                    playerCenterX = position.x + playerWidth / 2.0f;
-                    leftTile = static_cast<int>(position.x / tileSize);
-                    rightTile = static_cast<int>((position.x + playerWidth) / tileSize);
-                } else if (velocity.x > 0 && playerCenterX > wallLeft) {
-                    // Collision à droite
-                    position.x = wallLeft - playerWidth / 2.0f;
-                    velocity.x = 0.0f;
-                    player.setPosition(position);
-                    player.setVelocity(velocity);
-
-                    // Recalculer les tiles
-                    playerCenterX = position.x + playerWidth / 2.0f;
-                    leftTile = static_cast<int>(position.x / tileSize);
-                    rightTile = static_cast<int>((position.x + playerWidth) / tileSize);
-                }
-                break;
-            }
+    m_enemies.queryBodies(sf::FloatRect(player.getPosition(), sf::Vector2f(102.0f, 102.0f)), m_nearbyEnemies);
+    for (int index : m_nearbyEnemies) {
+        if (m_enemies.canDealDamage(index)) {
+            // Infliger 10% de dégâts (le joueur a 100 HP max)
+            player.takeDamage(10);
+            m_enemies.resetDamageCooldown(index);
+            std::cout << "Player hit by enemy! Health: " << player.getHealth() << "/" << player.getMaxHealth() << std::endl;
         }
     }
+}
 
-    // Vérifier collision avec le plafond (uniquement quand le joueur monte)
-    if (velocity.y < 0) {
-        for (int x = leftTile; x <= rightTile; ++x) {
-            if (m_tilemap->isSolid(x, topTile)) {
-                CollisionType tileType = m_tilemap->getCollisionType(x, topTile);
-
-                // Vérifier si c'est un plafond
-                if (tileType == CollisionType::CEILING) {
-                    sf::FloatRect ceilingBounds = m_tilemap->getTileCollisionBounds(x, topTile);
-                    float ceilingBottom = ceilingBounds.position.y + ceilingBounds.size.y;
-
-                    // Vérifier si le haut du joueur est proche du plafond
-                    if (position.y <= ceilingBottom + 2.0f) {
-                        // Arrêter le mouvement vertical uniquement
-                        velocity.y = 0.0f;
-                        player.setVelocity(velocity);
-
-                        if (frameCount % 60 == 0) {
-                            std::cout << "  -> Ceiling collision! topTile=" << topTile
-                                      << ", ceilingBottom=" << ceilingBottom << std::endl;
-                        }
-                        break;
-                    }
-                }
-            }
-        }
-    }
+void Level::handlePlayerCollision(Player& player) {
+    // Taille approximative du joueur (en se basant sur le sprite à l'échelle 0.2):
+    // 512 * 0.2 = 102 pixels, les pieds sont à 25 pixels du bas du sprite
+    static const CollisionBody playerBody{sf::Vector2f(102.0f, 102.0f), 25.0f};
 
-    // Vérifier collision avec le sol
-    bool onGround = false;
-    bool hasGroundTile = false;
+    // Rejouer le déplacement du dernier pas avec collisions continues: même chemin
+    // pour la marche, les sauts et la charge, sans traverser de tile à grande vitesse
+    const sf::Vector2f start = player.getPreviousPosition();
+    SweepResult result = TileCollision::move(*m_tilemap, playerBody, start, player.getPosition() - start);
 
-    // Vérifier d'abord s'il y a une tuile de sol (pas un mur) sous le joueur
-    for (int x = leftTile; x <= rightTile; ++x) {
-        if (m_tilemap->isSolid(x, bottomTile)) {
-            CollisionType tileType = m_tilemap->getCollisionType(x, bottomTile);
-            // Si c'est une tuile de sol (pas un mur), noter qu'on a un sol
-            if (tileType != CollisionType::WALL_LEFT && tileType != CollisionType::WALL_RIGHT) {
-                hasGroundTile = true;
-                break;
-            }
-        }
+    // Arrêter uniquement l'axe bloqué (le joueur glisse le long de la surface)
+    sf::Vector2f velocity = player.getVelocity();
+    if (result.hitWall) {
+        velocity.x = 0.0f;
+    }
+    if (result.hitCeiling || (result.grounded && velocity.y > 0.0f)) {
+        velocity.y = 0.0f;
     }
 
-    // Appliquer la collision avec le sol seulement si:
-    // 1. Il n'y a pas de mur OU il y a un sol sous le joueur (priorité au sol)
-    if (!touchingWall || hasGroundTile) {
-        for (int x = leftTile; x <= rightTile; ++x) {
-            // Vérifier si les pieds du joueur touchent une tile solide
-            if (m_tilemap->isSolid(x, bottomTile)) {
-                // Vérifier le type de collision de la tuile
-                CollisionType tileType = m_tilemap->getCollisionType(x, bottomTile);
-
-                // Ignorer la collision si c'est un mur (wall-left ou wall-right)
-                if (tileType == CollisionType::WALL_LEFT || tileType == CollisionType::WALL_RIGHT) {
-                    continue;  // Passer à la prochaine tuile
-                }
+    player.setPosition(result.position);
+    player.setVelocity(velocity);
+    player.setGrounded(result.grounded);
 
-                // Récupérer la profondeur d'herbe de la tile (en pourcentage)
-                float grassDepthPercent = m_tilemap->getGrassDepth(x, bottomTile);
-                float grassDepth = tileSize * (grassDepthPercent / 100.0f);
-                float groundY = bottomTile * tileSize + grassDepth - (playerHeight - feetOffset);
-
-                // Appliquer la collision uniquement si le joueur tombe (velocity.y >= 0)
-                // et qu'il est au niveau du sol ou en dessous (proche du sol)
-                if (velocity.y >= 0 && position.y >= groundY - 2.0f) {
-                    onGround = true;
-                    // Seulement ajuster la position si on est vraiment en dessous du sol
-                    if (position.y > groundY) {
-                        position.y = groundY;
-                    }
-                    velocity.y = 0.0f;
-                    player.setPosition(position);
-                    player.setVelocity(velocity);
-
-                    if (frameCount % 60 == 0) {
-                        std::cout << "  -> Collision! bottomTile=" << bottomTile
-                                  << ", groundY=" << groundY << ", grassDepth=" << grassDepth
-                                  << " (" << grassDepthPercent << "%)" << std::endl;
-                    }
-                }
-                break;
-            }
+    // Pour activer: mettre SHOW_DEBUG_COLLISIONS à true dans Level.hpp
+    if constexpr (SHOW_DEBUG_COLLISIONS) {
+        static int frameCount = 0;
+        if (frameCount++ % 60 == 0) {
+            std::cout << "Player Y: " << result.position.y << ", grounded: " << result.grounded
+                      << ", wall: " << result.hitWall << ", ceiling: " << result.hitCeiling << std::endl;
         }
     }
-
-    // Mettre à jour l'état du joueur
-    player.setGrounded(onGround);
 }
 
 bool Level::isPlayerAtFinish(const Player& player) const {
@@ -485,88 +305,80 @@ bool Level::isLevelValid(int levelNumber) {
 
     std::cout << "  Checking if level is valid: " << filename << std::endl;
 
-    // Vérifier si le fichier existe
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        std::cout << "  ERROR: Cannot open file " << filename << std::endl;
+    LevelData data;
+    if (!LevelFile::load(filename, data)) {
+        std::cout << "  ERROR: Cannot load file " << filename << std::endl;
         return false;
     }
 
-    std::cout << "  File opened successfully" << std::endl;
-
-    // Parser le JSON pour vérifier les portails
-    std::string line;
-    bool hasEntrancePortal = false;
-    bool hasExitPortal = false;
+    std::cout << "  Entrance portal: " << (data.entrance.present ? "YES" : "NO") << std::endl;
+    std::cout << "  Exit portal: " << (data.exit.present ? "YES" : "NO") << std::endl;
 
-    while (std::getline(file, line)) {
-        line.erase(std::remove_if(line.begin(), line.end(), ::isspace), line.end());
+    // Le niveau est valide s'il a les deux portails
+    bool isValid = data.entrance.present && data.exit.present;
+    std::cout << "  Level is valid: " << (isValid ? "YES" : "NO") << std::endl;
+    return isValid;
+}
 
-        if (line.find("\"entrancePortal\":{") != std::string::npos) {
-            hasEntrancePortal = true;
-            std::cout << "  Found entrance portal" << std::endl;
-        }
-        else if (line.find("\"exitPortal\":{") != std::string::npos) {
-            hasExitPortal = true;
-            std::cout << "  Found exit portal" << std::endl;
-        }
+bool Level::isVisible(const sf::FloatRect& bounds, const sf::FloatRect& visibleArea) {
+    if (bounds.findIntersection(visibleArea).has_value()) {
+        m_renderStats.drawn++;
+        return true;
     }
+    m_renderStats.culled++;
+    return false;
+}
 
-    file.close();
+void Level::render(sf::RenderWindow& window, const Camera& camera, float interpolation) {
+    m_renderStats = RenderStats();
+    if (m_headless) return;
 
-    std::cout << "  Entrance portal: " << (hasEntrancePortal ? "YES" : "NO") << std::endl;
-    std::cout << "  Exit portal: " << (hasExitPortal ? "YES" : "NO") << std::endl;
+    // Zone visible de la caméra (avec une marge)
+    sf::FloatRect visibleArea = camera.getVisibleArea(CULLING_MARGIN);
 
-    // Le niveau est valide s'il a les deux portails
-    bool isValid = hasEntrancePortal && hasExitPortal;
-    std::cout << "  Level is valid: " << (isValid ? "YES" : "NO") << std::endl;
-    return isValid;
-}
+    ParticleBatch& batch = ParticleBatch::getInstance();
 
-void Level::render(sf::RenderWindow& window) {
     // Dessiner les effets ambiants d'arrière-plan (derrière les tiles)
-    renderAmbientBackground(window);
+    renderAmbientBackground(batch, visibleArea);
+    batch.flush(window);
+
+    // Dessiner la tilemap (culling par chunks)
+    {
+        ProfileScope scope(ProfileStage::TileRender);
+        m_tilemap->render(window);
+    }
+    m_renderStats.drawnChunks = m_tilemap->getDrawnChunkCount();
+    m_renderStats.culledChunks = m_tilemap->getCulledChunkCount();
 
-    // Dessiner la tilemap
-    m_tilemap->render(window);
+    const float tileSize = 64.0f;
+    const float portalExtent = tileSize * 0.6f + 3.0f;  // Lueur extérieure + contour
 
     // Dessiner le portail d'entrée
     if (m_hasEntrancePortal) {
         if (m_isPrologueLevel) {
             // Niveau prologue : afficher la porte médiévale
-            if (m_doorTextureLoaded && m_entranceDoorSprite) {
+            if (m_doorTextureLoaded && m_entranceDoorSprite &&
+                isVisible(m_entranceDoorSprite->getGlobalBounds(), visibleArea)) {
                 window.draw(*m_entranceDoorSprite);
             }
         } else {
             // Autres niveaux : afficher un portail d'entrée (vert)
             float centerX = m_entrancePortalPosition.x + 32.0f;
             float centerY = m_entrancePortalPosition.y + 32.0f;
-            const float tileSize = 64.0f;
-
-            // Cercle extérieur (lueur verte)
-            sf::CircleShape outerGlow(tileSize * 0.6f);
-            outerGlow.setOrigin(sf::Vector2f(tileSize * 0.6f, tileSize * 0.6f));
-            outerGlow.setPosition(sf::Vector2f(centerX, centerY));
-            outerGlow.setFillColor(sf::Color(0, 255, 0, 50));
-            outerGlow.setOutlineColor(sf::Color(0, 255, 0, 150));
-            outerGlow.setOutlineThickness(3.0f);
-            window.draw(outerGlow);
-
-            // Cercle du milieu
-            sf::CircleShape middleRing(tileSize * 0.4f);
-            middleRing.setOrigin(sf::Vector2f(tileSize * 0.4f, tileSize * 0.4f));
-            middleRing.setPosition(sf::Vector2f(centerX, centerY));
-            middleRing.setFillColor(sf::Color(0, 200, 0, 100));
-            middleRing.setOutlineColor(sf::Color(100, 255, 100, 200));
-            middleRing.setOutlineThickness(2.0f);
-            window.draw(middleRing);
+            sf::FloatRect portalBounds(sf::Vector2f(centerX - portalExtent, centerY - portalExtent),
+                                       sf::Vector2f(portalExtent * 2.0f, portalExtent * 2.0f));
 
-            // Point central brillant
-            sf::CircleShape innerCore(tileSize * 0.2f);
-            innerCore.setOrigin(sf::Vector2f(tileSize * 0.2f, tileSize * 0.2f));
-            innerCore.setPosition(sf::Vector2f(centerX, centerY));
-            innerCore.setFillColor(sf::Color(255, 255, 255, 200));
-            window.draw(innerCore);
+            if (isVisible(portalBounds, visibleArea)) {
+                sf::Vector2f center(centerX, centerY);
+
+                // Lueur verte: cercle du milieu et halo extérieur
+                batch.addGlow(center, tileSize * 0.6f, tileSize * 0.4f, sf::Color(0, 220, 0, 130), 0.4f);
+                batch.addRing(center, tileSize * 0.6f, 3.0f, sf::Color(0, 255, 0, 150));
+                batch.addRing(center, tileSize * 0.4f, 2.0f, sf::Color(100, 255, 100, 200));
+
+                // Point central brillant
+                batch.addCircle(center, tileSize * 0.2f, sf::Color(255, 255, 255, 200));
+            }
         }
     }
 
@@ -574,47 +386,58 @@ void Level::render(sf::RenderWindow& window) {
     if (m_hasExitPortal) {
         float centerX = m_exitPortalPosition.x + 32.0f;
         float centerY = m_exitPortalPosition.y + 32.0f;
-        const float tileSize = 64.0f;
-
-        // Cercle extérieur (lueur cyan)
-        sf::CircleShape outerGlow(tileSize * 0.6f);
-        outerGlow.setOrigin(sf::Vector2f(tileSize * 0.6f, tileSize * 0.6f));
-        outerGlow.setPosition(sf::Vector2f(centerX, centerY));
-        outerGlow.setFillColor(sf::Color(0, 255, 255, 50));
-        outerGlow.setOutlineColor(sf::Color(0, 255, 255, 150));
-        outerGlow.setOutlineThickness(3.0f);
-        window.draw(outerGlow);
-
-        // Cercle du milieu
-        sf::CircleShape middleRing(tileSize * 0.4f);
-        middleRing.setOrigin(sf::Vector2f(tileSize * 0.4f, tileSize * 0.4f));
-        middleRing.setPosition(sf::Vector2f(centerX, centerY));
-        middleRing.setFillColor(sf::Color(0, 150, 255, 100));
-        middleRing.setOutlineColor(sf::Color(100, 200, 255, 200));
-        middleRing.setOutlineThickness(2.0f);
-        window.draw(middleRing);
-
-        // Point central brillant
-        sf::CircleShape innerCore(tileSize * 0.2f);
-        innerCore.setOrigin(sf::Vector2f(tileSize * 0.2f, tileSize * 0.2f));
-        innerCore.setPosition(sf::Vector2f(centerX, centerY));
-        innerCore.setFillColor(sf::Color(255, 255, 255, 200));
-        window.draw(innerCore);
-    }
-
-    // Dessiner tous les ennemis
-    for (const auto& enemy : m_enemies) {
-        if (enemy->isActive()) {
-            enemy->render(window);
+        sf::FloatRect portalBounds(sf::Vector2f(centerX - portalExtent, centerY - portalExtent),
+                                   sf::Vector2f(portalExtent * 2.0f, portalExtent * 2.0f));
+
+        if (isVisible(portalBounds, visibleArea)) {
+            sf::Vector2f center(centerX, centerY);
+
+            // Lueur cyan: cercle du milieu et halo extérieur
+            batch.addGlow(center, tileSize * 0.6f, tileSize * 0.4f, sf::Color(0, 190, 255, 130), 0.4f);
+            batch.addRing(center, tileSize * 0.6f, 3.0f, sf::Color(0, 255, 255, 150));
+            batch.addRing(center, tileSize * 0.4f, 2.0f, sf::Color(100, 200, 255, 200));
+
+            // Point central brillant
+            batch.addCircle(center, tileSize * 0.2f, sf::Color(255, 255, 255, 200));
         }
     }
 
+    // Dessiner les ennemis visibles (corps, puis orbites par-dessus) et les explosions en cours
+    m_visibleEnemies.clear();
+    for (std::size_t i = 0; i < m_enemies.size(); ++i) {
+        if (m_enemies.isAlive(i) && isVisible(m_enemies.getRenderBounds(i), visibleArea)) {
+            m_visibleEnemies.push_back(i);
+            m_enemies.render(i, batch, interpolation);
+        }
+    }
+    for (std::size_t index : m_visibleEnemies) {
+        m_enemies.renderOrbits(index, batch, interpolation);
+    }
+    for (std::size_t i = 0; i < m_enemies.getDeathEffectCount(); ++i) {
+        if (isVisible(m_enemies.getDeathEffectBounds(i), visibleArea)) {
+            m_enemies.renderDeathEffect(i, batch);
+        }
+    }
+    m_enemies.renderDeathParticles(batch);
+
     // Dessiner les effets ambiants de premier plan (devant les tiles et ennemis)
-    renderAmbientForeground(window);
+    renderAmbientForeground(batch, visibleArea);
+
+    // Portails, ennemis et particules ambiantes: un draw call par séquence (formes pleines / lueurs)
+    batch.flush(window);
+
+    // Pour activer: mettre SHOW_DEBUG_CULLING_STATS à true dans Level.hpp
+    if constexpr (SHOW_DEBUG_CULLING_STATS) {
+        static int frameCount = 0;
+        if (frameCount++ % 60 == 0) {
+            std::cout << "Culling: " << m_renderStats.drawn << " drawn, " << m_renderStats.culled << " culled | chunks: "
+                      << m_renderStats.drawnChunks << " drawn, " << m_renderStats.culledChunks << " culled" << std::endl;
+        }
+    }
 }
 
 void Level::addEnemy(const sf::Vector2f& position, float scale) {
-    m_enemies.push_back(std::make_unique<Enemy>(position, scale));
+    m_enemies.add(position, scale);
 }
 
 void Level::generateEnemies(int levelNumber) {
@@ -660,20 +483,21 @@ void Level::generateEnemies(int levelNumber) {
     std::cout << "Generating " << enemyCount << " enemies for level " << levelNumber
               << " (size: " << width << "x" << height << ")" << std::endl;
 
-    // Générateur de nombres aléatoires
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<int> xDist(1, width - 2);  // Éviter les bords
+    // Flux aléatoire du placement (graine du service Random)
+    Pcg32& rng = Random::getInstance().stream(RandomStream::Level);
 
     // Collecter toutes les positions de sol valides
     std::vector<sf::Vector2f> validGroundPositions;
 
-    for (int x = 1; x < width - 1; ++x) {
-        for (int y = 1; y < height - 1; ++y) {
+    // Parcours ligne par ligne des bits de collision (mémoire contiguë)
+    for (int y = 1; y < height - 1; ++y) {
+        const std::uint8_t* row = m_tilemap->getCellFlagsRow(y);
+        const std::uint8_t* below = m_tilemap->getCellFlagsRow(y + 1);
+        for (int x = 1; x < width - 1; ++x) {
             // Vérifier si la tuile actuelle est de l'air
-            if (!m_tilemap->isSolid(x, y)) {
+            if (!(row[x] & Tilemap::CELL_SOLID)) {
                 // Vérifier s'il y a une tuile solide juste en dessous (c'est un sol)
-                if (m_tilemap->isSolid(x, y + 1)) {
+                if (below[x] & Tilemap::CELL_SOLID) {
                     // Vérifier qu'on n'est pas trop proche des portails
                     float posX = x * 64.0f + 32.0f;  // Centre de la tuile
                     float posY = y * 64.0f + 32.0f;
@@ -703,9 +527,8 @@ void Level::generateEnemies(int levelNumber) {
         int actualEnemyCount = std::min(enemyCount, static_cast<int>(validGroundPositions.size()));
 
         for (int i = 0; i < actualEnemyCount; ++i) {
-            // Recalculer la distribution car la taille du vecteur change
-            std::uniform_int_distribution<size_t> posDist(0, validGroundPositions.size() - 1);
-            size_t index = posDist(gen);
+            // Tirage parmi les positions restantes (la taille du vecteur change)
+            size_t index = static_cast<size_t>(rng.rangeInt(0, static_cast<int>(validGroundPositions.size()) - 1));
             sf::Vector2f position = validGroundPositions[index];
 
             // Retirer cette position pour éviter les doublons
@@ -732,77 +555,24 @@ void Level::generateAmbientParticles() {
     int width = m_tilemap->getWidth();
     int height = m_tilemap->getHeight();
     int tileSize = m_tilemap->getTileSize();
+    float levelWidth = static_cast<float>(width * tileSize);
+    float levelHeight = static_cast<float>(height * tileSize);
 
-    // Générateur de nombres aléatoires
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    // Flux aléatoire du décor ambiant
+    Pcg32& rng = Random::getInstance().stream(RandomStream::Ambient);
 
     // Calculer le nombre de particules proportionnel à la taille du niveau
     int levelArea = width * height;
     int particleCount = std::max(20, std::min(80, levelArea / 15));  // Entre 20 et 80 particules
 
     std::cout << "Generating " << particleCount << " ambient particles for level (" << width << "x" << height << ")" << std::endl;
-
-    // Distributions pour les particules
-    std::uniform_real_distribution<float> xDist(0.0f, width * tileSize);
-    std::uniform_real_distribution<float> yDist(0.0f, height * tileSize);
-    std::uniform_real_distribution<float> sizeDist(1.5f, 4.0f);
-    std::uniform_real_distribution<float> alphaDist(15.0f, 40.0f);  // Très subtil
-    std::uniform_real_distribution<float> phaseDist(0.0f, 2.0f * 3.14159f);
-    std::uniform_real_distribution<float> speedDist(0.3f, 0.8f);
-    std::uniform_real_distribution<float> ampDist(8.0f, 25.0f);
-    std::uniform_real_distribution<float> driftDist(2.0f, 8.0f);
-    std::uniform_int_distribution<int> colorType(0, 3);
-
-    for (int i = 0; i < particleCount; ++i) {
-        AmbientParticle particle;
-        particle.position = sf::Vector2f(xDist(gen), yDist(gen));
-        particle.basePosition = particle.position;
-        particle.size = sizeDist(gen);
-        particle.alpha = alphaDist(gen);
-        particle.oscillationPhase = phaseDist(gen);
-        particle.oscillationSpeed = speedDist(gen);
-        particle.oscillationAmplitude = ampDist(gen);
-        particle.driftSpeed = driftDist(gen);
-
-        // Couleurs subtiles : blanc/beige légèrement doré (style poussière/pollen)
-        int ct = colorType(gen);
-        if (ct == 0) {
-            particle.color = sf::Color(255, 255, 240);  // Blanc chaud
-        } else if (ct == 1) {
-            particle.color = sf::Color(255, 248, 220);  // Beige clair
-        } else if (ct == 2) {
-            particle.color = sf::Color(245, 245, 220);  // Beige
-        } else {
-            particle.color = sf::Color(255, 250, 205);  // Jaune pâle (pollen)
-        }
-
-        m_ambientParticles.push_back(particle);
-    }
+    m_ambientParticles.generate(particleCount, levelWidth, levelHeight, rng);
 
     // Générer quelques rayons de lumière subtils (seulement quelques-uns)
     int rayCount = std::max(2, std::min(6, levelArea / 100));
+    m_lightRays.generate(rayCount, levelWidth, levelHeight, rng);
 
-    std::uniform_real_distribution<float> rayWidthDist(30.0f, 80.0f);
-    std::uniform_real_distribution<float> rayHeightDist(150.0f, 400.0f);
-    std::uniform_real_distribution<float> rayAlphaDist(8.0f, 18.0f);  // Très très subtil
-    std::uniform_real_distribution<float> rayAngleDist(-15.0f, 15.0f);
-    std::uniform_real_distribution<float> flickerSpeedDist(0.2f, 0.5f);
-
-    for (int i = 0; i < rayCount; ++i) {
-        LightRay ray;
-        ray.position = sf::Vector2f(xDist(gen), yDist(gen) * 0.3f);  // Plutôt vers le haut
-        ray.width = rayWidthDist(gen);
-        ray.height = rayHeightDist(gen);
-        ray.alpha = rayAlphaDist(gen);
-        ray.flickerPhase = phaseDist(gen);
-        ray.flickerSpeed = flickerSpeedDist(gen);
-        ray.angle = rayAngleDist(gen);
-
-        m_lightRays.push_back(ray);
-    }
-
-    std::cout << "Generated " << m_ambientParticles.size() << " particles and " << m_lightRays.size() << " light rays" << std::endl;
+    std::cout << "Generated " << m_ambientParticles.count() << " particles and " << m_lightRays.count() << " light rays" << std::endl;
 }
 
 void Level::updateAmbientEffects(sf::Time deltaTime) {
@@ -811,68 +581,41 @@ void Level::updateAmbientEffects(sf::Time deltaTime) {
 
     if (!m_tilemap) return;
 
-    int levelWidth = m_tilemap->getWidth() * m_tilemap->getTileSize();
-    int levelHeight = m_tilemap->getHeight() * m_tilemap->getTileSize();
+    float levelWidth = static_cast<float>(m_tilemap->getWidth() * m_tilemap->getTileSize());
+    float levelHeight = static_cast<float>(m_tilemap->getHeight() * m_tilemap->getTileSize());
 
     // Mettre à jour les particules ambiantes
-    for (auto& particle : m_ambientParticles) {
-        // Mouvement oscillatoire (flottement)
-        particle.oscillationPhase += particle.oscillationSpeed * dt;
-        if (particle.oscillationPhase > 2.0f * 3.14159f) {
-            particle.oscillationPhase -= 2.0f * 3.14159f;
-        }
-
-        // Calculer le décalage oscillatoire
-        float offsetX = std::sin(particle.oscillationPhase) * particle.oscillationAmplitude;
-        float offsetY = std::cos(particle.oscillationPhase * 0.7f) * particle.oscillationAmplitude * 0.5f;
-
-        // Dérive lente vers le haut
-        particle.basePosition.y -= particle.driftSpeed * dt;
-
-        // Wrap around si la particule sort du niveau (réapparaît en bas)
-        if (particle.basePosition.y < -50.0f) {
-            particle.basePosition.y = levelHeight + 50.0f;
-            // Nouvelle position X aléatoire
-            std::random_device rd;
-            std::mt19937 gen(rd());
-            std::uniform_real_distribution<float> xDist(0.0f, static_cast<float>(levelWidth));
-            particle.basePosition.x = xDist(gen);
-        }
-
-        // Position finale
-        particle.position.x = particle.basePosition.x + offsetX;
-        particle.position.y = particle.basePosition.y + offsetY;
-    }
+    m_ambientParticles.update(dt, levelWidth, levelHeight);
 
     // Mettre à jour les rayons de lumière (scintillement subtil)
-    for (auto& ray : m_lightRays) {
-        ray.flickerPhase += ray.flickerSpeed * dt;
-        if (ray.flickerPhase > 2.0f * 3.14159f) {
-            ray.flickerPhase -= 2.0f * 3.14159f;
-        }
-    }
+    m_lightRays.update(dt);
 }
 
-void Level::renderAmbientBackground(sf::RenderWindow& window) {
+void Level::renderAmbientBackground(ParticleBatch& batch, const sf::FloatRect& visibleArea) {
     // Dessiner les rayons de lumière en arrière-plan
-    for (const auto& ray : m_lightRays) {
-        // Calculer l'alpha avec scintillement
-        float flickerFactor = 0.7f + 0.3f * std::sin(ray.flickerPhase);
-        unsigned char alpha = static_cast<unsigned char>(ray.alpha * flickerFactor);
+    const LightRays& rays = m_lightRays;
+    for (std::size_t i = 0; i < rays.count(); ++i) {
+        sf::Vector2f position(rays.x[i], rays.y[i]);
 
-        // Créer un quad pour le rayon (rectangle avec dégradé simulé)
-        sf::ConvexShape rayShape(4);
+        // Le trapèze tourne autour de sa position: rayon englobant = largeur + hauteur
+        float extent = rays.width[i] + rays.height[i];
+        sf::FloatRect rayBounds(position - sf::Vector2f(extent, extent), sf::Vector2f(extent * 2.0f, extent * 2.0f));
+        if (!isVisible(rayBounds, visibleArea)) continue;
+
+        // Calculer l'alpha avec scintillement
+        float flickerFactor = 0.7f + 0.3f * FastMath::sin(rays.flickerPhase[i]);
+        unsigned char alpha = static_cast<unsigned char>(rays.alpha[i] * flickerFactor);
 
         // Calculer les points du rayon (trapèze évasé vers le bas)
-        float halfWidthTop = ray.width * 0.3f;
-        float halfWidthBottom = ray.width;
-        float angleRad = ray.angle * 3.14159f / 180.0f;
+        float halfWidthTop = rays.width[i] * 0.3f;
+        float halfWidthBottom = rays.width[i];
+        float angleRad = rays.angle[i] * FastMath::PI / 180.0f;
 
         // Points du trapèze
         sf::Vector2f topLeft(-halfWidthTop, 0.0f);
         sf::Vector2f topRight(halfWidthTop, 0.0f);
-        sf::Vector2f bottomRight(halfWidthBottom, ray.height);
-        sf::Vector2f bottomLeft(-halfWidthBottom, ray.height);
+        sf::Vector2f bottomRight(halfWidthBottom, rays.height[i]);
+        sf::Vector2f bottomLeft(-halfWidthBottom, rays.height[i]);
 
         // Rotation
         auto rotate = [angleRad](sf::Vector2f& p) {
@@ -889,36 +632,30 @@ void Level::renderAmbientBackground(sf::RenderWindow& window) {
         rotate(bottomRight);
         rotate(bottomLeft);
 
-        rayShape.setPoint(0, ray.position + topLeft);
-        rayShape.setPoint(1, ray.position + topRight);
-        rayShape.setPoint(2, ray.position + bottomRight);
-        rayShape.setPoint(3, ray.position + bottomLeft);
-
-        // Couleur dorée très subtile
-        rayShape.setFillColor(sf::Color(255, 250, 200, alpha));
-        window.draw(rayShape);
+        // Quad du rayon, couleur dorée très subtile
+        batch.addQuad(position + topLeft, position + topRight,
+                      position + bottomRight, position + bottomLeft,
+                      sf::Color(255, 250, 200, alpha));
     }
 }
 
-void Level::renderAmbientForeground(sf::RenderWindow& window) {
+void Level::renderAmbientForeground(ParticleBatch& batch, const sf::FloatRect& visibleArea) {
     // Dessiner les particules ambiantes au premier plan
-    for (const auto& particle : m_ambientParticles) {
+    const AmbientParticles& particles = m_ambientParticles;
+    for (std::size_t i = 0; i < particles.count(); ++i) {
+        sf::Vector2f position(particles.x[i], particles.y[i]);
+        float size = particles.size[i];
+        float haloRadius = size * 2.0f;
+        sf::FloatRect particleBounds(position - sf::Vector2f(haloRadius, haloRadius),
+                                     sf::Vector2f(haloRadius * 2.0f, haloRadius * 2.0f));
+        if (!isVisible(particleBounds, visibleArea)) continue;
+
         // Légère variation d'alpha basée sur le timer global (scintillement)
-        float flicker = 0.8f + 0.2f * std::sin(m_ambientTimer * 2.0f + particle.oscillationPhase);
-        unsigned char alpha = static_cast<unsigned char>(particle.alpha * flicker);
-
-        // Halo externe très subtil
-        sf::CircleShape halo(particle.size * 2.0f);
-        halo.setPosition(particle.position);
-        halo.setOrigin(sf::Vector2f(particle.size * 2.0f, particle.size * 2.0f));
-        halo.setFillColor(sf::Color(particle.color.r, particle.color.g, particle.color.b, alpha / 3));
-        window.draw(halo);
-
-        // Particule principale
-        sf::CircleShape shape(particle.size);
-        shape.setPosition(particle.position);
-        shape.setOrigin(sf::Vector2f(particle.size, particle.size));
-        shape.setFillColor(sf::Color(particle.color.r, particle.color.g, particle.color.b, alpha));
-        window.draw(shape);
+        float flicker = 0.8f + 0.2f * FastMath::sin(m_ambientTimer * 2.0f + particles.phase[i]);
+        unsigned char alpha = static_cast<unsigned char>(particles.alpha[i] * flicker);
+        const sf::Color& color = AmbientParticles::PALETTE[particles.colorIndex[i]];
+
+        // Particule principale et halo externe très subtil
+        batch.addGlow(position, haloRadius, size, sf::Color(color.r, color.g, color.b, alpha), 1.0f / 3.0f);
     }
 }
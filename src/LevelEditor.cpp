@@ -1,7 +1,8 @@
 #include "LevelEditor.hpp"
+#include "AssetLoader.hpp"
+#include "ResourceCache.hpp"
 #include "TileProperties.hpp"
 #include <fstream>
-#include <sstream>
 #include <iostream>
 
 LevelEditor::LevelEditor(int tileSize)
@@ -30,21 +31,29 @@ LevelEditor::LevelEditor(int tileSize)
     // Initialiser le niveau vide
     m_levelData.resize(m_height, std::vector<int>(m_width, -1));
 
-    // Charger le tileset
+    // Tileset vide jusqu'à requestAssets()
     m_tileset = std::make_shared<sf::Texture>();
-    if (!m_tileset->loadFromFile("assets/tiles/Mossy Tileset/Mossy - TileSet.png")) {
-        std::cerr << "Failed to load tileset for editor" << std::endl;
-    }
-    m_tileset->setSmooth(false);
 
     // Charger la police
-    if (!m_font.openFromFile("assets/Arial.ttf")) {
+    m_font = ResourceCache::getInstance().getFont("assets/Arial.ttf");
+    if (!m_font) {
         std::cerr << "Failed to load font for editor" << std::endl;
+        m_font = std::make_shared<sf::Font>();
     }
 
     std::cout << "Level Editor initialized (" << m_width << "x" << m_height << ")" << std::endl;
 }
 
+void LevelEditor::requestAssets(AssetLoader& loader) {
+    // Charger le tileset (version originale: la palette affiche les tiles en pleine résolution)
+    // (partagée avec la tilemap quand il n'y a pas de tileset cuit)
+    loader.loadTexture("assets/tiles/Mossy Tileset/Mossy - TileSet.png",
+        [this](const std::shared_ptr<sf::Texture>& texture, const CookedAssets::Entry&) {
+            m_tileset = texture;
+            m_tileset->setSmooth(false);
+        });
+}
+
 void LevelEditor::handleInput(sf::Event& event, const sf::RenderWindow& window) {
     if (!m_isActive) return;
 
@@ -607,7 +616,7 @@ void LevelEditor::renderPortals(sf::RenderWindow& window) {
         innerCore.setOutlineThickness(1.0f);
         window.draw(innerCore);
 
-        sf::Text portalText(m_font, "EXIT", 12);
+        sf::Text portalText(*m_font, "EXIT", 12);
         portalText.setPosition(sf::Vector2f(centerX - 15.0f, centerY - m_tileSize * 0.8f));
         portalText.setFillColor(sf::Color::Cyan);
         portalText.setOutlineColor(sf::Color::Black);
@@ -645,7 +654,7 @@ void LevelEditor::renderPortals(sf::RenderWindow& window) {
         innerCore.setOutlineThickness(1.0f);
         window.draw(innerCore);
 
-        sf::Text portalText(m_font, "START", 12);
+        sf::Text portalText(*m_font, "START", 12);
         portalText.setPosition(sf::Vector2f(centerX - 18.0f, centerY - m_tileSize * 0.8f));
         portalText.setFillColor(sf::Color::Green);
         portalText.setOutlineColor(sf::Color::Black);
@@ -669,28 +678,28 @@ void LevelEditor::renderUI(sf::RenderWindow& window) {
         modeText += " *";  // Indiquer les modifications non sauvegardées
     }
 
-    sf::Text text(m_font, modeText, 20);
+    sf::Text text(*m_font, modeText, 20);
     text.setPosition(sf::Vector2f(10, 10));
     text.setFillColor(sf::Color::White);
     window.draw(text);
 
     // Afficher le numéro du niveau
     std::string levelText = "Level: " + std::to_string(m_currentLevelNumber);
-    sf::Text levelDisplay(m_font, levelText, 20);
+    sf::Text levelDisplay(*m_font, levelText, 20);
     levelDisplay.setPosition(sf::Vector2f(10, 40));
     levelDisplay.setFillColor(sf::Color::Yellow);
     window.draw(levelDisplay);
 
     // Afficher les dimensions
     std::string sizeText = "Size: " + std::to_string(m_width) + "x" + std::to_string(m_height);
-    sf::Text sizeDisplay(m_font, sizeText, 20);
+    sf::Text sizeDisplay(*m_font, sizeText, 20);
     sizeDisplay.setPosition(sf::Vector2f(10, 70));
     sizeDisplay.setFillColor(sf::Color::White);
     window.draw(sizeDisplay);
 
     // Afficher les contrôles
     std::string controls = "T=Tile E=Enemy O=ExitPortal I=EntrPortal R=Resize | Esc=Editor Ctrl+Q=Quit | Ctrl+N=New Ctrl+S=Save Ctrl+L=Load";
-    sf::Text controlsText(m_font, controls, 14);
+    sf::Text controlsText(*m_font, controls, 14);
     controlsText.setPosition(sf::Vector2f(10, window.getSize().y - 30));
     controlsText.setFillColor(sf::Color(200, 200, 200));
     window.draw(controlsText);
@@ -703,55 +712,29 @@ void LevelEditor::setLevelData(const std::vector<std::vector<int>>& data) {
 }
 
 bool LevelEditor::saveToFile(const std::string& filepath) {
-    std::ofstream file(filepath);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open file for saving: " << filepath << std::endl;
-        return false;
-    }
-
-    file << "{\n";
-    file << "  \"width\": " << m_width << ",\n";
-    file << "  \"height\": " << m_height << ",\n";
-    file << "  \"tiles\": [\n";
-
+    LevelData data;
+    data.width = m_width;
+    data.height = m_height;
+    data.tiles.resize(static_cast<size_t>(m_width) * m_height);
     for (int y = 0; y < m_height; ++y) {
-        file << "    [";
         for (int x = 0; x < m_width; ++x) {
-            file << m_levelData[y][x];
-            if (x < m_width - 1) file << ", ";
+            data.tiles[static_cast<size_t>(y) * m_width + x] = static_cast<std::int16_t>(m_levelData[y][x]);
         }
-        file << "]";
-        if (y < m_height - 1) file << ",";
-        file << "\n";
     }
-
-    file << "  ],\n";
-    file << "  \"enemies\": [\n";
-
-    for (size_t i = 0; i < m_enemies.size(); ++i) {
-        const auto& enemy = m_enemies[i];
-        file << "    {\"x\": " << enemy.x << ", \"y\": " << enemy.y
-             << ", \"type\": " << enemy.enemyType << "}";
-        if (i < m_enemies.size() - 1) file << ",";
-        file << "\n";
+    for (const auto& enemy : m_enemies) {
+        data.enemies.push_back({enemy.x, enemy.y, enemy.enemyType});
     }
+    data.giantEnemies = m_giantEnemies;
+    data.entrance = {m_hasEntrancePortal, m_entrancePortalPosition.x, m_entrancePortalPosition.y};
+    data.exit = {m_hasExitPortal, m_exitPortalPosition.x, m_exitPortalPosition.y};
 
-    file << "  ],\n";
-    file << "  \"exitPortal\": ";
-    if (m_hasExitPortal) {
-        file << "{\"x\": " << m_exitPortalPosition.x << ", \"y\": " << m_exitPortalPosition.y << "},\n";
-    } else {
-        file << "null,\n";
-    }
-    file << "  \"entrancePortal\": ";
-    if (m_hasEntrancePortal) {
-        file << "{\"x\": " << m_entrancePortalPosition.x << ", \"y\": " << m_entrancePortalPosition.y << "}\n";
-    } else {
-        file << "null\n";
+    if (!LevelFile::saveJson(filepath, data)) {
+        return false;
     }
-    file << "}\n";
 
-    file.close();
+    // Version binaire à côté du JSON pour un chargement rapide en jeu
+    LevelFile::saveBinary(LevelFile::binaryPathFor(filepath), data);
+
     m_hasUnsavedChanges = false;  // Marquer comme sauvegardé
     std::cout << "Level saved to " << filepath << std::endl;
     return true;
@@ -760,101 +743,33 @@ bool LevelEditor::saveToFile(const std::string& filepath) {
 bool LevelEditor::loadFromFile(const std::string& filepath) {
     std::cout << "Loading level from: " << filepath << std::endl;
 
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open file: " << filepath << std::endl;
+    LevelData data;
+    if (!LevelFile::load(filepath, data)) {
         return false;
     }
 
-    // Parser le JSON simple ligne par ligne
-    std::string line;
-    std::vector<std::vector<int>> levelData;
-    std::vector<EnemyPlacement> enemies;
-    int width = 0, height = 0;
-    bool inTiles = false;
-    bool hasExitPortal = false;
-    sf::Vector2i exitPortalPos(0, 0);
-    bool hasEntrancePortal = false;
-    sf::Vector2i entrancePortalPos(0, 0);
-
-    while (std::getline(file, line)) {
-        // Enlever les espaces
-        line.erase(std::remove_if(line.begin(), line.end(), ::isspace), line.end());
-
-        if (line.find("\"width\":") != std::string::npos) {
-            size_t pos = line.find(":");
-            width = std::stoi(line.substr(pos + 1, line.find(",") - pos - 1));
-        }
-        else if (line.find("\"height\":") != std::string::npos) {
-            size_t pos = line.find(":");
-            height = std::stoi(line.substr(pos + 1, line.find(",") - pos - 1));
-        }
-        else if (line.find("\"tiles\":") != std::string::npos) {
-            inTiles = true;
-        }
-        else if (inTiles && line.find("[") == 0) {
-            // C'est une ligne de tiles
-            std::vector<int> row;
-            std::string content = line.substr(1);
-            size_t endPos = content.find_last_of("]");
-            if (endPos != std::string::npos) {
-                content = content.substr(0, endPos);
-            }
-
-            if (!content.empty()) {
-                std::stringstream ss(content);
-                std::string token;
-                while (std::getline(ss, token, ',')) {
-                    row.push_back(std::stoi(token));
-                }
-                levelData.push_back(row);
-            }
-        }
-        else if (line.find("],") == 0 || line.find("]") == 0) {
-            inTiles = false;
-        }
-        else if (line.find("\"exitPortal\":{") != std::string::npos) {
-            hasExitPortal = true;
-            size_t xPos = line.find("\"x\":");
-            size_t yPos = line.find("\"y\":");
-            if (xPos != std::string::npos && yPos != std::string::npos) {
-                int x = std::stoi(line.substr(xPos + 4, line.find(",", xPos) - xPos - 4));
-                int y = std::stoi(line.substr(yPos + 4, line.find("}", yPos) - yPos - 4));
-                exitPortalPos = sf::Vector2i(x, y);
-            }
-        }
-        else if (line.find("\"entrancePortal\":{") != std::string::npos) {
-            hasEntrancePortal = true;
-            size_t xPos = line.find("\"x\":");
-            size_t yPos = line.find("\"y\":");
-            if (xPos != std::string::npos && yPos != std::string::npos) {
-                int x = std::stoi(line.substr(xPos + 4, line.find(",", xPos) - xPos - 4));
-                int y = std::stoi(line.substr(yPos + 4, line.find("}", yPos) - yPos - 4));
-                entrancePortalPos = sf::Vector2i(x, y);
-            }
+    // Charger les données dans l'éditeur
+    m_width = data.width;
+    m_height = data.height;
+    m_levelData.assign(m_height, std::vector<int>(m_width));
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            m_levelData[y][x] = data.getTile(x, y);
         }
     }
-
-    file.close();
-
-    if (levelData.empty()) {
-        std::cerr << "No level data found in file" << std::endl;
-        return false;
+    m_enemies.clear();
+    for (const auto& enemy : data.enemies) {
+        m_enemies.push_back({enemy.x, enemy.y, enemy.type});
     }
+    m_giantEnemies = data.giantEnemies;
+    m_hasExitPortal = data.exit.present;
+    m_exitPortalPosition = sf::Vector2i(data.exit.x, data.exit.y);
+    m_hasEntrancePortal = data.entrance.present;
+    m_entrancePortalPosition = sf::Vector2i(data.entrance.x, data.entrance.y);
 
-    // Charger les données dans l'éditeur
-    m_width = width;
-    m_height = height;
-    m_levelData = levelData;
-    m_enemies = enemies;
-    m_hasExitPortal = hasExitPortal;
-    m_exitPortalPosition = exitPortalPos;
-    m_hasEntrancePortal = hasEntrancePortal;
-    m_entrancePortalPosition = entrancePortalPos;
-
-    std::cout << "Level loaded: " << width << "x" << height << std::endl;
-    std::cout << "Exit portal: " << (hasExitPortal ? "Yes" : "No") << std::endl;
-    std::cout << "Entrance portal: " << (hasEntrancePortal ? "Yes" : "No") << std::endl;
+    std::cout << "Level loaded: " << m_width << "x" << m_height << std::endl;
+    std::cout << "Exit portal: " << (m_hasExitPortal ? "Yes" : "No") << std::endl;
+    std::cout << "Entrance portal: " << (m_hasEntrancePortal ? "Yes" : "No") << std::endl;
 
     return true;
 }
@@ -875,6 +790,7 @@ void LevelEditor::newLevel() {
 
     // Effacer tous les ennemis et portails
     m_enemies.clear();
+    m_giantEnemies.clear();
     m_hasExitPortal = false;
     m_hasEntrancePortal = false;
 
@@ -950,13 +866,13 @@ void LevelEditor::renderLevelSelector(sf::RenderWindow& window) {
     window.draw(dialogBox);
 
     // Titre
-    sf::Text title(m_font, "SELECT LEVEL", 24);
+    sf::Text title(*m_font, "SELECT LEVEL", 24);
     title.setPosition(sf::Vector2f(boxX + 20, boxY + 20));
     title.setFillColor(sf::Color::Yellow);
     window.draw(title);
 
     // Instructions
-    sf::Text instructions(m_font, "Enter level number (1-99):", 18);
+    sf::Text instructions(*m_font, "Enter level number (1-99):", 18);
     instructions.setPosition(sf::Vector2f(boxX + 20, boxY + 70));
     instructions.setFillColor(sf::Color::White);
     window.draw(instructions);
@@ -971,20 +887,20 @@ void LevelEditor::renderLevelSelector(sf::RenderWindow& window) {
 
     // Texte saisi
     std::string displayText = m_levelInputBuffer.empty() ? "_" : m_levelInputBuffer;
-    sf::Text inputText(m_font, displayText, 24);
+    sf::Text inputText(*m_font, displayText, 24);
     inputText.setPosition(sf::Vector2f(boxX + 165, boxY + 105));
     inputText.setFillColor(sf::Color::White);
     window.draw(inputText);
 
     // Niveau actuel
     std::string currentText = "Current: " + std::to_string(m_currentLevelNumber);
-    sf::Text currentLevel(m_font, currentText, 16);
+    sf::Text currentLevel(*m_font, currentText, 16);
     currentLevel.setPosition(sf::Vector2f(boxX + 20, boxY + 110));
     currentLevel.setFillColor(sf::Color(150, 150, 150));
     window.draw(currentLevel);
 
     // Instructions touches
-    sf::Text keys(m_font, "ENTER to confirm | ESC to cancel", 14);
+    sf::Text keys(*m_font, "ENTER to confirm | ESC to cancel", 14);
     keys.setPosition(sf::Vector2f(boxX + 50, boxY + 160));
     keys.setFillColor(sf::Color(200, 200, 200));
     window.draw(keys);
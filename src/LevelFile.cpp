@@ -0,0 +1,406 @@
+#include "LevelFile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+const char* const LevelFile::BINARY_EXTENSION = ".bblv";
+
+namespace {
+    constexpr char MAGIC[4] = {'B', 'B', 'L', 'V'};
+    constexpr std::size_t HEADER_SIZE = 40;
+
+    enum HeaderFlags : std::uint16_t {
+        HasEntrance = 1 << 0,
+        HasExit = 1 << 1
+    };
+
+    bool isLittleEndianHost() {
+        const std::uint16_t probe = 1;
+        std::uint8_t firstByte;
+        std::memcpy(&firstByte, &probe, 1);
+        return firstByte == 1;
+    }
+
+    // Inverse l'ordre des octets de chaque élément (hôte big-endian uniquement)
+    void swapBytes(void* data, std::size_t elementSize, std::size_t count) {
+        std::uint8_t* bytes = static_cast<std::uint8_t*>(data);
+        for (std::size_t i = 0; i < count; ++i, bytes += elementSize) {
+            std::reverse(bytes, bytes + elementSize);
+        }
+    }
+
+    // Copie un tableau du fichier (little-endian) vers la mémoire
+    void readArray(const std::uint8_t* source, void* target, std::size_t elementSize, std::size_t count) {
+        if (count == 0) return;
+        std::memcpy(target, source, elementSize * count);
+        if (!isLittleEndianHost()) swapBytes(target, elementSize, count);
+    }
+
+    // Ajoute un tableau à la fin du tampon de sortie, en little-endian
+    void writeArray(std::vector<std::uint8_t>& out, const void* source, std::size_t elementSize, std::size_t count) {
+        std::size_t offset = out.size();
+        out.resize(offset + elementSize * count);
+        if (count == 0) return;
+        std::memcpy(out.data() + offset, source, elementSize * count);
+        if (!isLittleEndianHost()) swapBytes(out.data() + offset, elementSize, count);
+    }
+
+    std::size_t alignTo4(std::size_t size) {
+        return (size + 3) & ~static_cast<std::size_t>(3);
+    }
+
+    // Fichier projeté en mémoire en lecture seule (lu entièrement sous Windows)
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string& filepath) {
+#ifdef _WIN32
+            std::ifstream file(filepath, std::ios::binary);
+            if (!file.is_open()) return;
+            m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            m_data = reinterpret_cast<const std::uint8_t*>(m_buffer.data());
+            m_size = m_buffer.size();
+#else
+            int fd = ::open(filepath.c_str(), O_RDONLY);
+            if (fd < 0) return;
+
+            struct stat info;
+            if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+                void* mapping = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapping != MAP_FAILED) {
+                    m_data = static_cast<const std::uint8_t*>(mapping);
+                    m_size = static_cast<std::size_t>(info.st_size);
+                }
+            }
+            ::close(fd);  // La projection reste valide après la fermeture
+#endif
+        }
+
+        ~MappedFile() {
+#ifndef _WIN32
+            if (m_data) ::munmap(const_cast<std::uint8_t*>(m_data), m_size);
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool isOpen() const { return m_data != nullptr; }
+        const std::uint8_t* data() const { return m_data; }
+        std::size_t size() const { return m_size; }
+
+    private:
+        const std::uint8_t* m_data = nullptr;
+        std::size_t m_size = 0;
+#ifdef _WIN32
+        std::vector<char> m_buffer;
+#endif
+    };
+
+    // Valeur numérique après "key": dans une ligne sans espaces (fin à la virgule ou à l'accolade)
+    bool parseField(const std::string& line, const char* key, float& value) {
+        std::string pattern = std::string("\"") + key + "\":";
+        size_t pos = line.find(pattern);
+        if (pos == std::string::npos) return false;
+        pos += pattern.size();
+        size_t end = line.find_first_of(",}", pos);
+        value = std::stof(line.substr(pos, end - pos));
+        return true;
+    }
+
+    bool parsePosition(const std::string& line, int& x, int& y) {
+        float fx = 0.0f, fy = 0.0f;
+        if (!parseField(line, "x", fx) || !parseField(line, "y", fy)) return false;
+        x = static_cast<int>(fx);
+        y = static_cast<int>(fy);
+        return true;
+    }
+}
+
+std::string LevelFile::binaryPathFor(const std::string& jsonPath) {
+    return fs::path(jsonPath).replace_extension(BINARY_EXTENSION).string();
+}
+
+bool LevelFile::load(const std::string& filepath, LevelData& data) {
+    fs::path path(filepath);
+    if (path.extension() == BINARY_EXTENSION) {
+        return loadBinary(filepath, data);
+    }
+
+    // Préférer la version binaire si elle est à jour (le JSON reste la source éditée)
+    std::error_code error;
+    fs::path binaryPath = binaryPathFor(filepath);
+    if (fs::exists(binaryPath, error)) {
+        auto binaryTime = fs::last_write_time(binaryPath, error);
+        auto jsonTime = fs::last_write_time(path, error);
+        if (!error && binaryTime >= jsonTime && loadBinary(binaryPath.string(), data)) {
+            return true;
+        }
+    }
+
+    return loadJson(filepath, data);
+}
+
+bool LevelFile::loadBinary(const std::string& filepath, LevelData& data) {
+    MappedFile file(filepath);
+    if (!file.isOpen()) {
+        std::cerr << "Failed to open binary level: " << filepath << std::endl;
+        return false;
+    }
+
+    const std::uint8_t* bytes = file.data();
+    if (file.size() < HEADER_SIZE || std::memcmp(bytes, MAGIC, sizeof(MAGIC)) != 0) {
+        std::cerr << "Not a binary level file: " << filepath << std::endl;
+        return false;
+    }
+
+    std::uint16_t header16[2];
+    std::int32_t header32[6];
+    std::uint32_t counts[2];
+    readArray(bytes + 4, header16, sizeof(std::uint16_t), 2);
+    readArray(bytes + 8, header32, sizeof(std::int32_t), 6);
+    readArray(bytes + 32, counts, sizeof(std::uint32_t), 2);
+
+    if (header16[0] != BINARY_VERSION) {
+        std::cerr << "Unsupported binary level version " << header16[0] << " in " << filepath << std::endl;
+        return false;
+    }
+
+    const int width = header32[0];
+    const int height = header32[1];
+    if (width <= 0 || height <= 0) {
+        std::cerr << "Invalid level size in " << filepath << std::endl;
+        return false;
+    }
+
+    const std::size_t tileCount = static_cast<std::size_t>(width) * height;
+    const std::size_t tilesSize = alignTo4(tileCount * sizeof(std::int16_t));
+    const std::size_t enemiesSize = counts[0] * sizeof(LevelData::EnemyRecord);
+    const std::size_t giantsSize = counts[1] * sizeof(LevelData::GiantEnemyRecord);
+    if (file.size() < HEADER_SIZE + tilesSize + enemiesSize + giantsSize) {
+        std::cerr << "Truncated binary level: " << filepath << std::endl;
+        return false;
+    }
+
+    data.width = width;
+    data.height = height;
+    data.entrance = {(header16[1] & HasEntrance) != 0, header32[2], header32[3]};
+    data.exit = {(header16[1] & HasExit) != 0, header32[4], header32[5]};
+
+    const std::uint8_t* cursor = bytes + HEADER_SIZE;
+    data.tiles.resize(tileCount);
+    readArray(cursor, data.tiles.data(), sizeof(std::int16_t), tileCount);
+    cursor += tilesSize;
+
+    data.enemies.resize(counts[0]);
+    readArray(cursor, data.enemies.data(), sizeof(std::int32_t), counts[0] * 3);
+    cursor += enemiesSize;
+
+    data.giantEnemies.resize(counts[1]);
+    readArray(cursor, data.giantEnemies.data(), sizeof(std::int32_t), counts[1] * 3);
+
+    return true;
+}
+
+bool LevelFile::saveBinary(const std::string& filepath, const LevelData& data) {
+    static_assert(sizeof(LevelData::EnemyRecord) == 12, "EnemyRecord doit faire 12 octets");
+    static_assert(sizeof(LevelData::GiantEnemyRecord) == 12, "GiantEnemyRecord doit faire 12 octets");
+
+    std::vector<std::uint8_t> out;
+    out.reserve(HEADER_SIZE + alignTo4(data.tiles.size() * sizeof(std::int16_t)) +
+                (data.enemies.size() + data.giantEnemies.size()) * 12);
+
+    out.insert(out.end(), MAGIC, MAGIC + sizeof(MAGIC));
+    const std::uint16_t header16[2] = {
+        BINARY_VERSION,
+        static_cast<std::uint16_t>((data.entrance.present ? HasEntrance : 0) | (data.exit.present ? HasExit : 0))
+    };
+    const std::int32_t header32[6] = {data.width, data.height, data.entrance.x, data.entrance.y, data.exit.x, data.exit.y};
+    const std::uint32_t counts[2] = {static_cast<std::uint32_t>(data.enemies.size()),
+                                     static_cast<std::uint32_t>(data.giantEnemies.size())};
+    writeArray(out, header16, sizeof(std::uint16_t), 2);
+    writeArray(out, header32, sizeof(std::int32_t), 6);
+    writeArray(out, counts, sizeof(std::uint32_t), 2);
+
+    writeArray(out, data.tiles.data(), sizeof(std::int16_t), data.tiles.size());
+    out.resize(alignTo4(out.size()), 0);
+    // Les enregistrements sont composés de 3 champs de 4 octets
+    writeArray(out, data.enemies.data(), sizeof(std::int32_t), data.enemies.size() * 3);
+    writeArray(out, data.giantEnemies.data(), sizeof(std::int32_t), data.giantEnemies.size() * 3);
+
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open file for saving: " << filepath << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+    return static_cast<bool>(file);
+}
+
+bool LevelFile::loadJson(const std::string& filepath, LevelData& data) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open level file: " << filepath << std::endl;
+        return false;
+    }
+
+    // Lecture simple du JSON ligne par ligne (format écrit par saveJson / l'éditeur)
+    std::string line;
+    std::vector<std::vector<int>> rows;
+    int declaredWidth = 0;
+    bool inTiles = false;
+    bool inEnemies = false;
+
+    data = LevelData();
+
+    while (std::getline(file, line)) {
+        // Enlever les espaces
+        line.erase(std::remove_if(line.begin(), line.end(), ::isspace), line.end());
+
+        if (line.find("\"width\":") != std::string::npos) {
+            size_t pos = line.find(":");
+            declaredWidth = std::stoi(line.substr(pos + 1, line.find(",") - pos - 1));
+        }
+        else if (line.find("\"height\":") != std::string::npos) {
+            // La hauteur est celle des lignes de tiles réellement présentes
+        }
+        else if (line.find("\"tiles\":") != std::string::npos) {
+            inTiles = true;
+        }
+        else if (inTiles && line.find("[") == 0) {
+            // Ligne de tiles (peut avoir une virgule à la fin)
+            std::vector<int> row;
+            std::string content = line.substr(1);
+            size_t endPos = content.find_last_of("]");
+            if (endPos != std::string::npos) {
+                content = content.substr(0, endPos);
+            }
+
+            if (!content.empty()) {
+                std::stringstream ss(content);
+                std::string token;
+                while (std::getline(ss, token, ',')) {
+                    row.push_back(std::stoi(token));
+                }
+                rows.push_back(row);
+            }
+        }
+        else if (inTiles && (line.find("],") == 0 || line.find("]") == 0)) {
+            inTiles = false;
+        }
+        else if (line.find("\"enemies\":[") != std::string::npos) {
+            // Tableau vide sur une seule ligne: "enemies": [],
+            inEnemies = line.find("]") == std::string::npos;
+        }
+        else if (inEnemies && line.find("{") == 0) {
+            LevelData::EnemyRecord enemy{0, 0, 0};
+            float type = 0.0f;
+            if (parsePosition(line, enemy.x, enemy.y)) {
+                if (parseField(line, "type", type)) enemy.type = static_cast<int>(type);
+                data.enemies.push_back(enemy);
+            }
+        }
+        else if (inEnemies && line.find("]") == 0) {
+            inEnemies = false;
+        }
+        else if (line.find("\"entrancePortal\":{") != std::string::npos) {
+            data.entrance.present = parsePosition(line, data.entrance.x, data.entrance.y);
+        }
+        else if (line.find("\"exitPortal\":{") != std::string::npos) {
+            data.exit.present = parsePosition(line, data.exit.x, data.exit.y);
+        }
+        else if (line.find("\"giantEnemy\"") != std::string::npos) {
+            // Avec ou sans espace avant {, échelle optionnelle
+            LevelData::GiantEnemyRecord giant{0, 0, 1.0f};
+            if (parsePosition(line, giant.x, giant.y)) {
+                parseField(line, "scale", giant.scale);
+                data.giantEnemies.push_back(giant);
+            }
+        }
+    }
+
+    if (rows.empty()) {
+        std::cerr << "No level data found in file: " << filepath << std::endl;
+        return false;
+    }
+
+    // La largeur est celle de la première ligne (comme l'ancien chargeur), lignes courtes complétées par du vide
+    data.width = rows[0].empty() ? declaredWidth : static_cast<int>(rows[0].size());
+    data.height = static_cast<int>(rows.size());
+    data.tiles.assign(static_cast<std::size_t>(data.width) * data.height, -1);
+    for (int y = 0; y < data.height; ++y) {
+        int count = std::min(data.width, static_cast<int>(rows[y].size()));
+        for (int x = 0; x < count; ++x) {
+            data.tiles[static_cast<std::size_t>(y) * data.width + x] = static_cast<std::int16_t>(rows[y][x]);
+        }
+    }
+
+    return true;
+}
+
+bool LevelFile::saveJson(const std::string& filepath, const LevelData& data) {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open file for saving: " << filepath << std::endl;
+        return false;
+    }
+
+    file << "{\n";
+    file << "  \"width\": " << data.width << ",\n";
+    file << "  \"height\": " << data.height << ",\n";
+    file << "  \"tiles\": [\n";
+
+    for (int y = 0; y < data.height; ++y) {
+        file << "    [";
+        for (int x = 0; x < data.width; ++x) {
+            file << data.getTile(x, y);
+            if (x < data.width - 1) file << ", ";
+        }
+        file << "]";
+        if (y < data.height - 1) file << ",";
+        file << "\n";
+    }
+
+    file << "  ],\n";
+    file << "  \"enemies\": [\n";
+
+    for (size_t i = 0; i < data.enemies.size(); ++i) {
+        const auto& enemy = data.enemies[i];
+        file << "    {\"x\": " << enemy.x << ", \"y\": " << enemy.y << ", \"type\": " << enemy.type << "}";
+        if (i < data.enemies.size() - 1) file << ",";
+        file << "\n";
+    }
+
+    file << "  ],\n";
+    for (const auto& giant : data.giantEnemies) {
+        file << "  \"giantEnemy\": {\"x\": " << giant.x << ", \"y\": " << giant.y << ", \"scale\": " << giant.scale << "},\n";
+    }
+    file << "  \"exitPortal\": ";
+    if (data.exit.present) {
+        file << "{\"x\": " << data.exit.x << ", \"y\": " << data.exit.y << "},\n";
+    } else {
+        file << "null,\n";
+    }
+    file << "  \"entrancePortal\": ";
+    if (data.entrance.present) {
+        file << "{\"x\": " << data.entrance.x << ", \"y\": " << data.entrance.y << "}\n";
+    } else {
+        file << "null\n";
+    }
+    file << "}\n";
+
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,269 @@
+#include "ParticleBatch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+    // Les coordonnées de texture d'une lueur portent ses paramètres: le signe donne le coin
+    // du quad, |x| - 1 le rayon du noyau (fraction du rayon); |y| - 1 a pour partie entière
+    // la teinte blanche du noyau (0-255) et pour partie fractionnaire 0.25 + intensité / 2.
+    // Identiques sur les 4 coins, ces paramètres restent constants après interpolation.
+    const char* GLOW_VERTEX_SHADER = R"(
+        varying vec2 local;
+        varying float core;
+        varying float intensity;
+        varying float whiteness;
+
+        void main() {
+            gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+            gl_FrontColor = gl_Color;
+            vec2 params = gl_MultiTexCoord0.xy;
+            local = sign(params);
+            core = abs(params.x) - 1.0;
+            float packed = abs(params.y) - 1.0;
+            whiteness = floor(packed) / 255.0;
+            intensity = (fract(packed) - 0.25) * 2.0;
+        }
+    )";
+
+    const char* GLOW_FRAGMENT_SHADER = R"(
+        varying vec2 local;
+        varying float core;
+        varying float intensity;
+        varying float whiteness;
+
+        void main() {
+            float d = length(local);
+            float disc = 1.0 - smoothstep(core - 0.03, core + 0.03, d);
+            float halo = intensity * (1.0 - smoothstep(core, 1.0, d));
+            vec3 color = mix(gl_Color.rgb, vec3(1.0), whiteness * disc);
+            gl_FragColor = vec4(color, gl_Color.a * clamp(max(disc, halo), 0.0, 1.0));
+        }
+    )";
+}
+
+ParticleBatch& ParticleBatch::getInstance() {
+    static ParticleBatch instance;
+    return instance;
+}
+
+ParticleBatch::ParticleBatch()
+    : m_textureReady(false)
+    , m_textureFailed(false)
+    , m_glowShaderReady(false)
+    , m_glowShaderFailed(false)
+    , m_lastDrawCalls(0)
+    , m_lastVertexCount(0)
+{
+    m_vertices.reserve(4096);
+    m_runs.reserve(64);
+}
+
+bool ParticleBatch::createTexture() {
+    // Pré-rasteriser les disques une seule fois (créée au premier flush, quand le contexte OpenGL existe)
+    sf::Image image(sf::Vector2u(CELL_SIZE * 3, CELL_SIZE), sf::Color::Transparent);
+
+    const float center = CELL_SIZE / 2.0f;
+    const float radius = center - 1.0f;  // Garder un texel transparent autour pour le filtrage
+
+    for (unsigned int y = 0; y < CELL_SIZE; ++y) {
+        for (unsigned int x = 0; x < CELL_SIZE; ++x) {
+            float dx = x + 0.5f - center;
+            float dy = y + 0.5f - center;
+            float distance = std::sqrt(dx * dx + dy * dy);
+
+            // Disque net avec un bord anti-aliasé d'un texel
+            float hard = std::clamp(radius - distance + 0.5f, 0.0f, 1.0f);
+            image.setPixel(sf::Vector2u(x, y), sf::Color(255, 255, 255, static_cast<unsigned char>(hard * 255)));
+
+            // Disque doux: décroissance quadratique jusqu'au bord
+            float t = std::clamp(1.0f - distance / radius, 0.0f, 1.0f);
+            image.setPixel(sf::Vector2u(CELL_SIZE + x, y), sf::Color(255, 255, 255, static_cast<unsigned char>(t * t * 255)));
+
+            // Zone blanche unie pour les anneaux et quads
+            image.setPixel(sf::Vector2u(CELL_SIZE * 2 + x, y), sf::Color::White);
+        }
+    }
+
+    if (!m_texture.loadFromImage(image)) {
+        std::cerr << "ParticleBatch: failed to create particle texture" << std::endl;
+        return false;
+    }
+    m_texture.setSmooth(true);
+    return true;
+}
+
+bool ParticleBatch::createGlowShader() {
+    // Compilé au premier addGlow, pendant le rendu (le contexte OpenGL existe)
+    if (!sf::Shader::isAvailable()) {
+        return false;
+    }
+    if (!m_glowShader.loadFromMemory(GLOW_VERTEX_SHADER, GLOW_FRAGMENT_SHADER)) {
+        std::cerr << "ParticleBatch: failed to compile glow shader" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::vector<sf::Vertex>& ParticleBatch::texturedRun() {
+    beginRun(false);
+    return m_vertices;
+}
+
+void ParticleBatch::beginRun(bool glow) {
+    if (m_runs.empty() || m_runs.back().glow != glow) {
+        m_runs.push_back({glow, m_vertices.size()});
+    }
+}
+
+void ParticleBatch::addTexturedQuad(const sf::Vector2f& center, float radius, const sf::Color& color, float texOffsetX) {
+    if (radius <= 0.0f || color.a == 0) return;
+
+    // Le disque de la texture occupe CELL_SIZE - 2 texels: agrandir le quad en conséquence
+    const float scale = CELL_SIZE / (CELL_SIZE - 2.0f);
+    float r = radius * scale;
+
+    sf::Vector2f topLeft(center.x - r, center.y - r);
+    sf::Vector2f topRight(center.x + r, center.y - r);
+    sf::Vector2f bottomRight(center.x + r, center.y + r);
+    sf::Vector2f bottomLeft(center.x - r, center.y + r);
+
+    sf::Vector2f texTopLeft(texOffsetX, 0.0f);
+    sf::Vector2f texTopRight(texOffsetX + CELL_SIZE, 0.0f);
+    sf::Vector2f texBottomRight(texOffsetX + CELL_SIZE, static_cast<float>(CELL_SIZE));
+    sf::Vector2f texBottomLeft(texOffsetX, static_cast<float>(CELL_SIZE));
+
+    std::vector<sf::Vertex>& vertices = texturedRun();
+    vertices.push_back({topLeft, color, texTopLeft});
+    vertices.push_back({topRight, color, texTopRight});
+    vertices.push_back({bottomRight, color, texBottomRight});
+    vertices.push_back({topLeft, color, texTopLeft});
+    vertices.push_back({bottomRight, color, texBottomRight});
+    vertices.push_back({bottomLeft, color, texBottomLeft});
+}
+
+void ParticleBatch::addCircle(const sf::Vector2f& center, float radius, const sf::Color& color) {
+    addTexturedQuad(center, radius, color, HARD_DISC_OFFSET);
+}
+
+void ParticleBatch::addSoftCircle(const sf::Vector2f& center, float radius, const sf::Color& color) {
+    addTexturedQuad(center, radius, color, SOFT_DISC_OFFSET);
+}
+
+void ParticleBatch::addRing(const sf::Vector2f& center, float radius, float thickness, const sf::Color& color) {
+    if (thickness <= 0.0f || color.a == 0) return;
+
+    // Table cos/sin partagée par tous les anneaux
+    static const std::vector<sf::Vector2f> unitCircle = [] {
+        std::vector<sf::Vector2f> points(RING_SEGMENTS + 1);
+        for (int i = 0; i <= RING_SEGMENTS; ++i) {
+            float angle = i * 2.0f * 3.14159265f / RING_SEGMENTS;
+            points[i] = sf::Vector2f(std::cos(angle), std::sin(angle));
+        }
+        return points;
+    }();
+
+    const sf::Vector2f white(WHITE_TEXEL_X, WHITE_TEXEL_Y);
+    const float inner = radius;
+    const float outer = radius + thickness;
+
+    std::vector<sf::Vertex>& vertices = texturedRun();
+    for (int i = 0; i < RING_SEGMENTS; ++i) {
+        sf::Vector2f innerA = center + unitCircle[i] * inner;
+        sf::Vector2f outerA = center + unitCircle[i] * outer;
+        sf::Vector2f innerB = center + unitCircle[i + 1] * inner;
+        sf::Vector2f outerB = center + unitCircle[i + 1] * outer;
+
+        vertices.push_back({innerA, color, white});
+        vertices.push_back({outerA, color, white});
+        vertices.push_back({outerB, color, white});
+        vertices.push_back({innerA, color, white});
+        vertices.push_back({outerB, color, white});
+        vertices.push_back({innerB, color, white});
+    }
+}
+
+void ParticleBatch::addGlow(const sf::Vector2f& center, float radius, float coreRadius, const sf::Color& color, float intensity,
+                            float coreWhiteness) {
+    if (radius <= 0.0f || color.a == 0) return;
+
+    if (!m_glowShaderReady && !m_glowShaderFailed) {
+        m_glowShaderReady = createGlowShader();
+        m_glowShaderFailed = !m_glowShaderReady;
+    }
+
+    if (!m_glowShaderReady) {
+        // Sans shader: halo doux et noyau plein dans la couche texturée
+        const float white = std::clamp(coreWhiteness, 0.0f, 1.0f);
+        auto tint = [white](unsigned char channel) {
+            return static_cast<unsigned char>(channel + (255 - channel) * white);
+        };
+        addSoftCircle(center, radius, sf::Color(color.r, color.g, color.b, static_cast<unsigned char>(color.a * std::clamp(intensity, 0.0f, 1.0f))));
+        addCircle(center, coreRadius, sf::Color(tint(color.r), tint(color.g), tint(color.b), color.a));
+        return;
+    }
+
+    const float core = 1.0f + std::clamp(coreRadius / radius, 0.0f, 1.0f);
+    const float halo = 1.0f + std::round(std::clamp(coreWhiteness, 0.0f, 1.0f) * 255.0f)
+                     + 0.25f + 0.5f * std::clamp(intensity, 0.0f, 1.0f);
+
+    sf::Vector2f topLeft(center.x - radius, center.y - radius);
+    sf::Vector2f topRight(center.x + radius, center.y - radius);
+    sf::Vector2f bottomRight(center.x + radius, center.y + radius);
+    sf::Vector2f bottomLeft(center.x - radius, center.y + radius);
+
+    beginRun(true);
+    m_vertices.push_back({topLeft, color, {-core, -halo}});
+    m_vertices.push_back({topRight, color, {core, -halo}});
+    m_vertices.push_back({bottomRight, color, {core, halo}});
+    m_vertices.push_back({topLeft, color, {-core, -halo}});
+    m_vertices.push_back({bottomRight, color, {core, halo}});
+    m_vertices.push_back({bottomLeft, color, {-core, halo}});
+}
+
+void ParticleBatch::addQuad(const sf::Vector2f& p0, const sf::Vector2f& p1, const sf::Vector2f& p2, const sf::Vector2f& p3,
+                            const sf::Color& color) {
+    if (color.a == 0) return;
+
+    const sf::Vector2f white(WHITE_TEXEL_X, WHITE_TEXEL_Y);
+
+    std::vector<sf::Vertex>& vertices = texturedRun();
+    vertices.push_back({p0, color, white});
+    vertices.push_back({p1, color, white});
+    vertices.push_back({p2, color, white});
+    vertices.push_back({p0, color, white});
+    vertices.push_back({p2, color, white});
+    vertices.push_back({p3, color, white});
+}
+
+void ParticleBatch::flush(sf::RenderTarget& target, const sf::Transform& transform) {
+    m_lastDrawCalls = 0;
+    m_lastVertexCount = m_vertices.size();
+
+    if (m_lastVertexCount > 0 && !m_textureReady && !m_textureFailed) {
+        m_textureReady = createTexture();
+        m_textureFailed = !m_textureReady;
+    }
+
+    // Séquences dans l'ordre d'ajout (lueurs sans texture, leurs coordonnées sont des paramètres)
+    for (std::size_t i = 0; i < m_runs.size(); ++i) {
+        const Run& run = m_runs[i];
+        const std::size_t end = (i + 1 < m_runs.size()) ? m_runs[i + 1].start : m_vertices.size();
+        if (end == run.start || (!run.glow && !m_textureReady)) continue;
+
+        sf::RenderStates states;
+        states.blendMode = sf::BlendAlpha;
+        states.transform = transform;
+        if (run.glow) {
+            states.shader = &m_glowShader;
+        } else {
+            states.texture = &m_texture;
+        }
+        target.draw(m_vertices.data() + run.start, end - run.start, sf::PrimitiveType::Triangles, states);
+        m_lastDrawCalls++;
+    }
+
+    // clear() garde la capacité: pas de réallocation d'une frame à l'autre
+    m_vertices.clear();
+    m_runs.clear();
+}
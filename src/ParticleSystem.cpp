@@ -1,79 +1,209 @@
 #include "ParticleSystem.hpp"
 #include <cmath>
-#include <random>
 
-ParticleSystem::ParticleSystem() {
+ParticleSystem::ParticleSystem(const ParticleEffect& effect, std::size_t capacity)
+    : m_effect(effect)
+    , m_capacity(capacity)
+{
+    m_particles.reserve(capacity);
 }
 
-void ParticleSystem::createDisintegrationEffect(const sf::Vector2f& position, const sf::Color& baseColor) {
-    // Générateur de nombres aléatoires
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> angleDist(0.0f, 360.0f);
-    std::uniform_real_distribution<float> speedDist(PARTICLE_MIN_SPEED, PARTICLE_MAX_SPEED);
-    std::uniform_real_distribution<float> sizeDist(PARTICLE_MIN_SIZE, PARTICLE_MAX_SIZE);
-    std::uniform_real_distribution<float> lifetimeDist(PARTICLE_LIFETIME * 0.7f, PARTICLE_LIFETIME * 1.3f);
+void ParticleSystem::emit(const sf::Vector2f& position, float angle, const sf::Color& color, float scale) {
+    if (m_particles.size() >= m_capacity) return;  // Pool plein
 
-    // Créer les particules
-    for (int i = 0; i < PARTICLE_COUNT; ++i) {
-        Particle particle;
+    Pcg32& rng = Random::getInstance().stream(RandomStream::Particles);
+    float speed = rng.range(m_effect.speedMin, m_effect.speedMax);
 
-        // Position initiale (centre du joueur)
-        particle.position = position;
+    Particle particle;
+    particle.position = position;
+    particle.velocity = sf::Vector2f(std::cos(angle) * speed, std::sin(angle) * speed) + m_effect.velocityOffset;
+    particle.color = color;
+    particle.age = 0.0f;
+    particle.lifetime = rng.range(m_effect.lifetimeMin, m_effect.lifetimeMax);
+    particle.size = rng.range(m_effect.sizeMin, m_effect.sizeMax) * scale;
+    m_particles.push_back(particle);
+}
 
-        // Vitesse dans une direction aléatoire
-        float angle = angleDist(gen) * 3.14159f / 180.0f;
-        float speed = speedDist(gen);
-        particle.velocity.x = std::cos(angle) * speed;
-        particle.velocity.y = std::sin(angle) * speed - 100.0f; // Légère direction vers le haut
+float ParticleSystem::burstAngle(int index, int count, Pcg32& rng) const {
+    if (m_effect.ring) {
+        return m_effect.angleMin + (m_effect.angleMax - m_effect.angleMin) * (index / static_cast<float>(count))
+             + rng.range(0.0f, m_effect.angleJitter);
+    }
+    return rng.range(m_effect.angleMin, m_effect.angleMax);
+}
 
-        // Couleur basée sur la couleur du joueur avec variations
-        particle.color = baseColor;
-        particle.color.a = 255;
+void ParticleSystem::burst(const sf::Vector2f& position, int count, float scale) {
+    Pcg32& rng = Random::getInstance().stream(RandomStream::Particles);
+    for (int i = 0; i < count; ++i) {
+        const sf::Color& color = m_effect.palette[rng.rangeInt(0, m_effect.paletteSize - 1)];
+        emit(position, burstAngle(i, count, rng), color, scale);
+    }
+}
 
-        // Taille et durée de vie
-        particle.size = sizeDist(gen);
-        particle.maxLifetime = lifetimeDist(gen);
-        particle.lifetime = particle.maxLifetime;
+void ParticleSystem::burst(const sf::Vector2f& position, int count, const sf::Color& color, float scale) {
+    Pcg32& rng = Random::getInstance().stream(RandomStream::Particles);
+    for (int i = 0; i < count; ++i) {
+        emit(position, burstAngle(i, count, rng), color, scale);
+    }
+}
+
+void ParticleSystem::spawn(const sf::Vector2f& position, const sf::Vector2f& velocity, float size, const sf::Color& color) {
+    if (m_particles.size() >= m_capacity) return;  // Pool plein
+
+    Particle particle;
+    particle.position = position;
+    particle.velocity = velocity;
+    particle.color = color;
+    particle.age = 0.0f;
+    particle.lifetime = Random::getInstance().stream(RandomStream::Particles).range(m_effect.lifetimeMin, m_effect.lifetimeMax);
+    particle.size = size;
+    m_particles.push_back(particle);
+}
 
-        m_particles.push_back(particle);
+int ParticleSystem::addEmitter(const sf::Vector2f& position, float rate) {
+    for (int i = 0; i < MAX_EMITTERS; ++i) {
+        if (!m_emitters[i].active) {
+            m_emitters[i] = Emitter{position, rate, 0.0f, true};
+            return i;
+        }
     }
+    return -1;
+}
+
+void ParticleSystem::setEmitterPosition(int emitter, const sf::Vector2f& position) {
+    if (emitter < 0 || emitter >= MAX_EMITTERS) return;  // -1: addEmitter a échoué
+    m_emitters[emitter].position = position;
+}
+
+void ParticleSystem::setEmitterRate(int emitter, float rate) {
+    if (emitter < 0 || emitter >= MAX_EMITTERS) return;  // -1: addEmitter a échoué
+    m_emitters[emitter].rate = rate;
+}
+
+void ParticleSystem::removeEmitter(int emitter) {
+    if (emitter < 0 || emitter >= MAX_EMITTERS) return;  // -1: addEmitter a échoué
+    m_emitters[emitter].active = false;
+}
+
+void ParticleSystem::clear() {
+    m_particles.clear();
 }
 
 void ParticleSystem::update(sf::Time deltaTime) {
     float dt = deltaTime.asSeconds();
 
-    // Mettre à jour chaque particule
-    for (auto it = m_particles.begin(); it != m_particles.end();) {
-        // Diminuer la durée de vie
-        it->lifetime -= dt;
-
-        // Supprimer si morte
-        if (it->lifetime <= 0.0f) {
-            it = m_particles.erase(it);
-            continue;
-        }
+    // Émission continue: les fractions de particule s'accumulent d'un pas à l'autre
+    for (Emitter& emitter : m_emitters) {
+        if (!emitter.active) continue;
+        emitter.accumulator += emitter.rate * dt;
+        int count = static_cast<int>(emitter.accumulator);
+        emitter.accumulator -= count;
+        burst(emitter.position, count);
+    }
 
-        // Appliquer la gravité
-        it->velocity.y += GRAVITY * dt;
+    // Friction exprimée par pas de 1/60 s: même comportement quel que soit le pas
+    const float friction = m_effect.friction == 1.0f ? 1.0f : std::pow(m_effect.friction, dt * 60.0f);
+    const float gravity = m_effect.gravity * dt;
 
-        // Mettre à jour la position
-        it->position += it->velocity * dt;
+    for (std::size_t i = 0; i < m_particles.size();) {
+        Particle& particle = m_particles[i];
+        particle.age += dt;
 
-        // Fade out basé sur la durée de vie restante
-        float lifeRatio = it->lifetime / it->maxLifetime;
-        it->color.a = static_cast<unsigned char>(255 * lifeRatio);
+        // Morte: remplacée par la dernière particule (qui est traitée au même index)
+        if (particle.age >= particle.lifetime) {
+            particle = m_particles.back();
+            m_particles.pop_back();
+            continue;
+        }
 
-        ++it;
+        particle.position += particle.velocity * dt;
+        particle.velocity *= friction;
+        particle.velocity.y += gravity;
+        ++i;
     }
 }
 
-void ParticleSystem::render(sf::RenderWindow& window) {
+void ParticleSystem::render(ParticleBatch& batch) const {
     for (const auto& particle : m_particles) {
-        sf::CircleShape shape(particle.size);
-        shape.setPosition(particle.position);
-        shape.setFillColor(particle.color);
-        shape.setOrigin(sf::Vector2f(particle.size, particle.size));
-        window.draw(shape);
+        float progress = particle.age / particle.lifetime;
+        float size = particle.size * m_effect.sizeOverLife.at(progress);
+        float alpha = 255.0f * m_effect.alphaOverLife.at(progress);
+        const sf::Color& color = particle.color;
+
+        // Particule principale, avec son halo en un seul quad
+        sf::Color mainColor(color.r, color.g, color.b, static_cast<unsigned char>(alpha));
+        if (m_effect.haloScale > 0.0f) {
+            batch.addGlow(particle.position, size * m_effect.haloScale, size, mainColor, m_effect.haloAlpha);
+        } else {
+            batch.addCircle(particle.position, size, mainColor);
+        }
+    }
+
+    // Coeurs brillants dans une seconde passe: une seule séquence du batch au-dessus des lueurs
+    if (m_effect.coreScale > 0.0f) {
+        for (const auto& particle : m_particles) {
+            float progress = particle.age / particle.lifetime;
+            float size = particle.size * m_effect.sizeOverLife.at(progress);
+            float alpha = 255.0f * m_effect.alphaOverLife.at(progress);
+            batch.addCircle(particle.position, size * m_effect.coreScale,
+                            sf::Color(255, 255, 255, static_cast<unsigned char>(alpha * m_effect.coreAlpha)));
+        }
     }
 }
+
+namespace ParticleEffects {
+
+ParticleEffect disintegration() {
+    ParticleEffect effect;
+    effect.speedMin = 50.0f;
+    effect.speedMax = 200.0f;
+    effect.velocityOffset = sf::Vector2f(0.0f, -100.0f);  // Légère direction vers le haut
+    effect.sizeMin = 2.0f;
+    effect.sizeMax = 6.0f;
+    effect.lifetimeMin = 1.5f * 0.7f;
+    effect.lifetimeMax = 1.5f * 1.3f;
+    effect.gravity = 200.0f;
+    return effect;
+}
+
+ParticleEffect heroChargeExplosion() {
+    ParticleEffect effect;
+    effect.ring = true;  // Directions réparties sur le cercle
+    effect.angleJitter = 0.3f;
+    effect.speedMin = 200.0f;
+    effect.speedMax = 400.0f;
+    effect.sizeMin = 8.0f;
+    effect.sizeMax = 16.0f;
+    effect.lifetimeMin = 0.4f;  // Disparition rapide
+    effect.lifetimeMax = 0.4f;
+    effect.palette = {sf::Color(255, 180, 50), sf::Color(255, 255, 100), sf::Color(255, 255, 220), sf::Color::White};
+    effect.paletteSize = 3;     // Orange, jaune, blanc
+    effect.friction = 0.95f;
+    effect.sizeOverLife = {1.0f, 0.48f};  // Rétrécissement (0.97 par pas sur 24 pas)
+    effect.haloScale = 1.5f;
+    effect.haloAlpha = 100.0f / 255.0f;
+    return effect;
+}
+
+ParticleEffect enemyDeath() {
+    ParticleEffect effect;
+    effect.speedMin = 150.0f;
+    effect.speedMax = 400.0f;
+    effect.sizeMin = 4.0f;
+    effect.sizeMax = 12.0f;
+    effect.lifetimeMin = 1.0f / 1.8f;
+    effect.lifetimeMax = 1.0f / 1.8f;
+    // Palette de couleurs : rouge, orange, jaune, blanc (feu)
+    effect.palette = {sf::Color(200, 50, 30), sf::Color(255, 120, 30), sf::Color(255, 220, 80), sf::Color(255, 255, 220)};
+    effect.paletteSize = 4;
+    effect.gravity = 200.0f;     // Légère gravité
+    effect.friction = 0.96f;
+    effect.sizeOverLife = {1.0f, 0.51f};  // Rétrécissement (0.98 par pas sur 33 pas)
+    effect.haloScale = 1.8f;
+    effect.haloAlpha = 60.0f / 255.0f;
+    effect.coreScale = 0.4f;
+    effect.coreAlpha = 200.0f / 255.0f;
+    return effect;
+}
+
+}
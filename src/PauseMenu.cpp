@@ -1,4 +1,5 @@
 #include "PauseMenu.hpp"
+#include "ResourceCache.hpp"
 #include <iostream>
 
 PauseMenu::PauseMenu()
@@ -9,27 +10,25 @@ PauseMenu::PauseMenu()
     m_menuItems = {"Continuer", "Recommencer", "Quitter"};
 
     // Charger la police - essayer plusieurs chemins possibles
-    bool fontLoaded = false;
+    ResourceCache& cache = ResourceCache::getInstance();
 
     // Chemin 1: relatif au répertoire de travail
-    if (m_font.openFromFile("assets/Arial.ttf")) {
-        fontLoaded = true;
+    if ((m_font = cache.getFont("assets/Arial.ttf"))) {
         std::cout << "Police chargée depuis: assets/Arial.ttf" << std::endl;
     }
     // Chemin 2: dans le bundle macOS
-    else if (m_font.openFromFile("../Resources/assets/Arial.ttf")) {
-        fontLoaded = true;
+    else if ((m_font = cache.getFont("../Resources/assets/Arial.ttf"))) {
         std::cout << "Police chargée depuis: ../Resources/assets/Arial.ttf" << std::endl;
     }
     // Chemin 3: police système
-    else if (m_font.openFromFile("/System/Library/Fonts/Supplemental/Arial.ttf")) {
-        fontLoaded = true;
+    else if ((m_font = cache.getFont("/System/Library/Fonts/Supplemental/Arial.ttf"))) {
         std::cout << "Police chargée depuis le système" << std::endl;
     }
 
-    if (!fontLoaded) {
+    if (!m_font) {
         std::cerr << "ERREUR: Impossible de charger la police Arial.ttf" << std::endl;
         std::cerr << "Le texte du menu ne s'affichera pas correctement." << std::endl;
+        m_font = std::make_shared<sf::Font>();
     }
 
     // Fond semi-transparent
@@ -44,7 +43,7 @@ PauseMenu::PauseMenu()
     m_menuBox.setOutlineColor(sf::Color(100, 100, 120));
 
     // Titre du menu
-    m_titleText = std::make_unique<sf::Text>(m_font, "PAUSE", 40);
+    m_titleText = std::make_unique<sf::Text>(*m_font, "PAUSE", 40);
     m_titleText->setFillColor(sf::Color::White);
 
     // Centrer le titre "PAUSE" horizontalement
@@ -62,7 +61,7 @@ PauseMenu::PauseMenu()
         m_itemBoxes[i].setPosition(sf::Vector2f(490.0f, 290.0f + i * 80.0f));
         m_itemBoxes[i].setOutlineThickness(2.0f);
 
-        m_menuTexts[i] = std::make_unique<sf::Text>(m_font, m_menuItems[i], 28);
+        m_menuTexts[i] = std::make_unique<sf::Text>(*m_font, m_menuItems[i], 28);
         m_menuTexts[i]->setFillColor(sf::Color::White);
 
         // Centrer le texte dans la boîte
@@ -1,11 +1,14 @@
 #include "Player.hpp"
+#include "AssetLoader.hpp"
+#include "ResourceCache.hpp"
+#include <algorithm>
 #include <iostream>
 #include <cmath>
-#include <cstdlib>
-#include <ctime>
 
-Player::Player(CharacterType characterType)
+Player::Player(CharacterType characterType, bool headless, AssetLoader* loader)
     : m_position(0.0f, 0.0f)
+    , m_previousPosition(0.0f, 0.0f)
+    , m_interpolationPosition(0.0f, 0.0f)
     , m_velocity(0.0f, 0.0f)
     , m_state(State::Idle)
     , m_previousState(State::Idle)
@@ -19,11 +22,13 @@ Player::Player(CharacterType characterType)
     , m_characterType(characterType)
     , m_spriteScale(0.2f)  // Valeur par défaut pour le Magicien
     , m_animationSpeed(1.0f)  // Valeur par défaut
+    , m_animations(std::make_shared<Animations>())  // Vide en headless
     , m_currentFrame(0)
     , m_frameTimer(0.0f)
     , m_health(100)
     , m_maxHealth(100)
     , m_invincibilityTimer(0.0f)
+    , m_particleSystem(ParticleEffects::disintegration(), 2 * ParticleEffects::DISINTEGRATION_COUNT)
     , m_isDisintegrating(false)
     , m_hasDoubleJump(false)
     , m_jumpsRemaining(1)
@@ -36,6 +41,7 @@ Player::Player(CharacterType characterType)
     , m_chargeAlpha(1.0f)
     , m_chargeDirection(1.0f, 0.0f)
     , m_chargeStartPosition(0.0f, 0.0f)
+    , m_explosionParticles(ParticleEffects::heroChargeExplosion(), 2 * ParticleEffects::HERO_CHARGE_COUNT)
     , m_firefly1Position(0.0f, 0.0f)
     , m_firefly2Position(0.0f, 0.0f)
     , m_fireflyLagPosition(0.0f, 0.0f)
@@ -43,67 +49,94 @@ Player::Player(CharacterType characterType)
     , m_fireflyAlpha1(0.0f)
     , m_fireflyAlpha2(0.0f)
 {
+    // Simulation sans rendu: la physique ne dépend ni des sprites ni des sons
+    if (headless) {
+        return;
+    }
+
+    if (m_characterType == CharacterType::Goat) {
+        m_spriteScale = 0.363f;  // Agrandi de 10% supplémentaire (0.33 * 1.1 = 0.363)
+        m_animationSpeed = 2.2f;  // Animation 2.2x plus lente
+    }
+
+    // Frames déjà chargées par un joueur précédent du même personnage
+    ResourceCache& cache = ResourceCache::getInstance();
+    const std::string animationsKey = m_characterType == CharacterType::Wizard ? "player/wizard" : "player/goat";
+    if (auto animations = cache.find<Animations>(animationsKey)) {
+        m_animations = animations;
+    } else {
+        cache.store(animationsKey, m_animations);
+        if (loader) {
+            requestFrames(*loader);
+        } else {
+            AssetLoader ownLoader;
+            requestFrames(ownLoader);
+            ownLoader.finish();
+        }
+    }
+    if (!loader) {
+        finishLoading();
+    }
+
+    // Charger le son de saut
+    m_jumpSoundBuffer = cache.getSoundBuffer("assets/sounds/jump1.wav");
+    if (m_jumpSoundBuffer) {
+        m_jumpSound = std::make_unique<sf::Sound>(*m_jumpSoundBuffer);
+        m_jumpSound->setVolume(50.0f); // Volume à 50%
+        std::cout << "✓ Son de saut chargé avec succès!" << std::endl;
+    } else {
+        std::cerr << "✗ Échec du chargement du son de saut (assets/sounds/jump1.wav)" << std::endl;
+    }
+}
+
+void Player::requestFrames(AssetLoader& loader) {
     // Charger les animations selon le personnage
     if (m_characterType == CharacterType::Wizard) {
         std::cout << "Chargement des animations du Blue Wizard..." << std::endl;
-        m_spriteScale = 0.2f;
-        m_animationSpeed = 1.0f;  // Vitesse normale
-        loadAnimationFrames("assets/tiles/BlueWizard/2BlueWizardIdle", "Chara - BlueIdle", 20, m_idleTextures);
-        loadAnimationFrames("assets/tiles/BlueWizard/2BlueWizardWalk", "Chara_BlueWalk", 20, m_walkTextures);
-        loadAnimationFrames("assets/tiles/BlueWizard/2BlueWizardJump", "CharaWizardJump_", 8, m_jumpTextures);
-
-        // Créer le sprite avec la première frame de l'animation idle
-        if (!m_idleTextures.empty()) {
-            m_sprite = std::make_unique<sf::Sprite>(*m_idleTextures[0]);
-            m_sprite->setScale(sf::Vector2f(m_spriteScale, m_spriteScale));
-            std::cout << "✓ Animations chargées avec succès!" << std::endl;
-        } else {
-            std::cerr << "✗ Échec du chargement des animations!" << std::endl;
-        }
+        loadAnimationFrames(loader, "assets/tiles/BlueWizard/2BlueWizardIdle", "Chara - BlueIdle", 20, m_animations->idleFrames);
+        loadAnimationFrames(loader, "assets/tiles/BlueWizard/2BlueWizardWalk", "Chara_BlueWalk", 20, m_animations->walkFrames);
+        loadAnimationFrames(loader, "assets/tiles/BlueWizard/2BlueWizardJump", "CharaWizardJump_", 8, m_animations->jumpFrames);
     } else if (m_characterType == CharacterType::Goat) {
         std::cout << "Chargement des animations de la Chèvre..." << std::endl;
-        m_spriteScale = 0.363f;  // Agrandi de 10% supplémentaire (0.33 * 1.1 = 0.363)
-        m_animationSpeed = 2.2f;  // Animation 2.2x plus lente
 
         // Idle: chevre-statique-droite (1 frame statique depuis le dossier static)
-        auto idleTexture = std::make_shared<sf::Texture>();
-        if (idleTexture->loadFromFile("assets/tiles/Chevre/static/chevre-statique-droite-00.png")) {
-            m_idleTextures.push_back(idleTexture);
-        }
+        loadFrame(loader, "assets/tiles/Chevre/static/chevre-statique-droite-00.png", m_animations->idleFrames);
 
         // Walk: chevre-course (7 frames: 00 à 06 depuis le dossier principal)
-        loadAnimationFrames("assets/tiles/Chevre", "chevre-course-", 7, m_walkTextures);
+        loadAnimationFrames(loader, "assets/tiles/Chevre", "chevre-course-", 7, m_animations->walkFrames);
 
         // Jump: chevre-saute (1 frame: 01 depuis le dossier principal)
-        auto jumpTexture = std::make_shared<sf::Texture>();
-        if (jumpTexture->loadFromFile("assets/tiles/Chevre/chevre-saute-01.png")) {
-            m_jumpTextures.push_back(jumpTexture);
-        }
+        loadFrame(loader, "assets/tiles/Chevre/chevre-saute-01.png", m_animations->jumpFrames);
+    }
+}
 
-        // Créer le sprite avec la première frame de l'animation idle
-        if (!m_idleTextures.empty()) {
-            m_sprite = std::make_unique<sf::Sprite>(*m_idleTextures[0]);
-            m_sprite->setScale(sf::Vector2f(m_spriteScale, m_spriteScale));
-            std::cout << "✓ Chèvre chargée avec succès!" << std::endl;
-        } else {
-            std::cerr << "✗ Échec du chargement de la chèvre!" << std::endl;
+void Player::finishLoading() {
+    Animations& animations = *m_animations;
+    if (!animations.built) {
+        // Retirer les frames qui n'ont pas pu être décodées
+        for (std::vector<int>* frames : {&animations.idleFrames, &animations.walkFrames, &animations.jumpFrames}) {
+            frames->erase(std::remove(frames->begin(), frames->end(), -1), frames->end());
         }
+        std::cout << "  - " << animations.idleFrames.size() << " idle, " << animations.walkFrames.size() << " walk, "
+                  << animations.jumpFrames.size() << " jump frames chargées" << std::endl;
+        animations.built = animations.atlas.build();
     }
 
-    // Charger le son de saut
-    if (m_jumpSoundBuffer.loadFromFile("assets/sounds/jump1.wav")) {
-        m_jumpSound = std::make_unique<sf::Sound>(m_jumpSoundBuffer);
-        m_jumpSound->setVolume(50.0f); // Volume à 50%
-        std::cout << "✓ Son de saut chargé avec succès!" << std::endl;
+    // Créer le sprite avec la première frame de l'animation idle
+    if (animations.built && !animations.idleFrames.empty()) {
+        m_sprite = std::make_unique<sf::Sprite>(animations.atlas.getPageTexture(0));
+        applyFrame(animations.idleFrames[0]);
+        // Frames cuites déjà réduites: compenser pour garder la même taille à l'écran
+        m_spriteScale /= animations.atlas.getFrame(animations.idleFrames[0]).scale;
+        m_sprite->setScale(sf::Vector2f(m_spriteScale, m_spriteScale));
+        std::cout << "✓ Animations chargées avec succès!" << std::endl;
     } else {
-        std::cerr << "✗ Échec du chargement du son de saut (assets/sounds/jump1.wav)" << std::endl;
+        std::cerr << "✗ Échec du chargement des animations!" << std::endl;
     }
 }
 
-void Player::loadAnimationFrames(const std::string& directory, const std::string& prefix, int frameCount, std::vector<std::shared_ptr<sf::Texture>>& textures) {
+void Player::loadAnimationFrames(AssetLoader& loader, const std::string& directory, const std::string& prefix, int frameCount, std::vector<int>& frames) {
     for (int i = 0; i < frameCount; ++i) {
-        auto texture = std::make_shared<sf::Texture>();
-
         // Déterminer le format de numérotation (2 ou 5 chiffres)
         std::string filename;
         if (prefix.find("Blue") != std::string::npos) {
@@ -113,18 +146,33 @@ void Player::loadAnimationFrames(const std::string& directory, const std::string
             // Format Goat: "chevre-course-00.png" (2 chiffres)
             filename = directory + "/" + prefix + std::string(2 - std::to_string(i).length(), '0') + std::to_string(i) + ".png";
         }
-
-        if (texture->loadFromFile(filename)) {
-            textures.push_back(texture);
-        } else {
-            std::cerr << "Erreur lors du chargement de: " << filename << std::endl;
-        }
+        loadFrame(loader, filename, frames);
     }
+}
+
+void Player::loadFrame(AssetLoader& loader, const std::string& filepath, std::vector<int>& frames) {
+    // Emplacement réservé: l'ordre de l'animation ne dépend pas de l'ordre de décodage
+    std::size_t slot = frames.size();
+    frames.push_back(-1);
+
+    // L'image rejoint l'atlas (envoyé au GPU par m_animations->atlas.build())
+    loader.loadImage(filepath, [animations = m_animations, &frames, slot](sf::Image& image, const CookedAssets::Entry& source) {
+        frames[slot] = animations->atlas.addDecoded(image, source);
+    }, true);
+}
+
+void Player::applyFrame(int frameIndex) {
+    const TextureAtlas::Frame& frame = m_animations->atlas.getFrame(frameIndex);
+    const sf::Texture& page = m_animations->atlas.getPageTexture(frame.page);
 
-    std::cout << "  - " << textures.size() << " frames chargées depuis " << directory << std::endl;
+    // Ne changer de texture que si la frame est sur une autre page de l'atlas
+    if (&m_sprite->getTexture() != &page) {
+        m_sprite->setTexture(page, false);
+    }
+    m_sprite->setTextureRect(frame.rect);
 }
 
-void Player::loadSpriteSheet(const std::string& filepath, int frameWidth, int frameHeight, int totalFrames, std::vector<std::shared_ptr<sf::Texture>>& textures) {
+void Player::loadSpriteSheet(const std::string& filepath, int frameWidth, int frameHeight, int totalFrames, std::vector<int>& frames) {
     // Charger l'image complète
     sf::Image spriteSheet;
     if (!spriteSheet.loadFromFile(filepath)) {
@@ -148,13 +196,11 @@ void Player::loadSpriteSheet(const std::string& filepath, int frameWidth, int fr
         int row = i / columns;
         int col = i % columns;
 
-        // Créer une texture pour cette frame
-        auto texture = std::make_shared<sf::Texture>();
-
-        // Charger juste la région de cette frame depuis le sprite sheet
+        // Ajouter juste la région de cette frame à l'atlas
         sf::IntRect area(sf::Vector2i(col * frameWidth, row * frameHeight), sf::Vector2i(frameWidth, frameHeight));
-        if (texture->loadFromImage(spriteSheet, false, area)) {
-            textures.push_back(texture);
+        int frameIndex = m_animations->atlas.addImage(spriteSheet, area);
+        if (frameIndex >= 0) {
+            frames.push_back(frameIndex);
             framesLoaded++;
         } else {
             std::cerr << "    ✗ Échec de l'extraction de la frame " << i << std::endl;
@@ -286,42 +332,15 @@ void Player::update(sf::Time deltaTime) {
             m_chargeTimer = CHARGE_DURATION;
             m_invincibilityTimer = CHARGE_DURATION + 0.3f;
 
-            // Créer l'explosion de particules
-            std::srand(static_cast<unsigned>(std::time(nullptr)));
-            for (int i = 0; i < 24; ++i) {
-                ExplosionParticle p;
-                float angle = (i / 24.0f) * 2.0f * 3.14159f + (std::rand() % 100) / 100.0f * 0.3f;
-                float speed = 200.0f + (std::rand() % 200);
-                p.position = playerCenter;
-                p.velocity = sf::Vector2f(std::cos(angle) * speed, std::sin(angle) * speed);
-                p.life = 1.0f;
-                p.size = 8.0f + (std::rand() % 8);
-
-                // Couleurs variées : orange, jaune, blanc
-                int colorType = std::rand() % 3;
-                if (colorType == 0) p.color = sf::Color(255, 180, 50, 255);
-                else if (colorType == 1) p.color = sf::Color(255, 255, 100, 255);
-                else p.color = sf::Color(255, 255, 220, 255);
-
-                m_explosionParticles.push_back(p);
-            }
+            // Créer l'explosion de particules (couleurs variées : orange, jaune, blanc)
+            m_explosionParticles.burst(playerCenter, ParticleEffects::HERO_CHARGE_COUNT);
 
             std::cout << "Hero Charge ACTIVATED!" << std::endl;
         }
     }
 
     // Mettre à jour les particules d'explosion
-    for (auto& p : m_explosionParticles) {
-        p.position += p.velocity * dt;
-        p.velocity *= 0.95f;  // Friction
-        p.life -= dt * 2.5f;  // Disparition rapide
-        p.size *= 0.97f;      // Rétrécissement
-    }
-    // Supprimer les particules mortes
-    m_explosionParticles.erase(
-        std::remove_if(m_explosionParticles.begin(), m_explosionParticles.end(),
-            [](const ExplosionParticle& p) { return p.life <= 0.0f; }),
-        m_explosionParticles.end());
+    m_explosionParticles.update(deltaTime);
 
     // Phase de charge active
     if (m_isCharging) {
@@ -414,6 +433,34 @@ void Player::update(sf::Time deltaTime) {
             std::remove_if(m_fireflyTrail2.begin(), m_fireflyTrail2.end(),
                 [](const FireflyTrailPoint& p) { return p.age >= 1.0f; }),
             m_fireflyTrail2.end());
+
+        // Animation de vol réaliste (mouvement en forme de 8 allongé), un pas par tick
+        m_fireflyTimer += 0.08f; // Vitesse d'animation
+
+        // Mouvement vertical et horizontal pour un vol naturel
+        float offsetY = std::sin(m_fireflyTimer) * 5.0f;
+        float offsetX = std::cos(m_fireflyTimer * 0.7f) * 3.0f; // Fréquence différente pour effet de lemniscate
+
+        // Mouvement déphasé pour un effet naturel (les deux lucioles ne volent pas de la même façon)
+        float offsetY2 = std::sin(m_fireflyTimer + 1.5f) * 5.0f; // Déphasage de ~90°
+        float offsetX2 = std::cos(m_fireflyTimer * 0.7f + 1.5f) * 3.0f;
+
+        // Positions actuelles (avec inertie) et nouveaux points de traînée
+        m_firefly1Position = sf::Vector2f(m_fireflyLagPosition.x - 15.0f + offsetX, m_fireflyLagPosition.y + offsetY);
+        m_firefly2Position = sf::Vector2f(m_fireflyLagPosition.x + 15.0f + offsetX2, m_fireflyLagPosition.y + offsetY2);
+
+        if (m_fireflyAlpha1 > 0.1f) {  // Ajouter des points de traînée seulement si assez visible
+            m_fireflyTrail1.push_back({m_firefly1Position, 0.0f});
+            if (m_fireflyTrail1.size() > MAX_TRAIL_POINTS) {
+                m_fireflyTrail1.erase(m_fireflyTrail1.begin());
+            }
+        }
+        if (m_fireflyAlpha2 > 0.1f) {
+            m_fireflyTrail2.push_back({m_firefly2Position, 0.0f});
+            if (m_fireflyTrail2.size() > MAX_TRAIL_POINTS) {
+                m_fireflyTrail2.erase(m_fireflyTrail2.begin());
+            }
+        }
     }
 }
 
@@ -459,10 +506,11 @@ void Player::updatePhysics(sf::Time deltaTime) {
         }
     }
 
-    // Mise à jour de la position
+    // Mise à jour de la position (le niveau rejoue ensuite ce déplacement avec
+    // collisions continues depuis m_previousPosition, voir Level::handlePlayerCollision)
+    m_previousPosition = m_position;
     m_position += m_velocity * dt;
 
-    // La gestion du sol est maintenant entièrement gérée par le système de niveau (Level::handlePlayerCollision)
     // On garde juste la détection de l'état de chute
     if (m_velocity.y > 0 && m_state != State::Falling && !m_isGrounded) {
         m_state = State::Falling;
@@ -482,23 +530,23 @@ void Player::updateAnimation(sf::Time deltaTime) {
         m_previousState = m_state;
     }
 
-    // Sélectionner le bon ensemble de textures selon l'état
-    std::vector<std::shared_ptr<sf::Texture>>* currentAnimation = nullptr;
+    // Sélectionner le bon ensemble de frames selon l'état
+    const std::vector<int>* currentAnimation = nullptr;
 
     switch (m_state) {
         case State::Idle:
-            currentAnimation = &m_idleTextures;
+            currentAnimation = &m_animations->idleFrames;
             break;
         case State::Walking:
         case State::Running:
-            currentAnimation = &m_walkTextures;
+            currentAnimation = &m_animations->walkFrames;
             break;
         case State::Jumping:
         case State::Falling:
-            currentAnimation = &m_jumpTextures;
+            currentAnimation = &m_animations->jumpFrames;
             break;
         default:
-            currentAnimation = &m_idleTextures;
+            currentAnimation = &m_animations->idleFrames;
             break;
     }
 
@@ -512,16 +560,19 @@ void Player::updateAnimation(sf::Time deltaTime) {
             m_frameTimer -= effectiveFrameTime;
             m_currentFrame = (m_currentFrame + 1) % currentAnimation->size();
 
-            // Changer la texture du sprite
-            m_sprite->setTexture(*(*currentAnimation)[m_currentFrame], false);
+            // Changer la zone de l'atlas affichée par le sprite
+            applyFrame((*currentAnimation)[m_currentFrame]);
         }
     }
 }
 
-void Player::render(sf::RenderWindow& window) {
+void Player::render(sf::RenderWindow& window, float interpolation) {
     // Si le joueur est en train de se désintégrer, afficher les particules au lieu du sprite
+    ParticleBatch& batch = ParticleBatch::getInstance();
+
     if (m_isDisintegrating) {
-        m_particleSystem.render(window);
+        m_particleSystem.render(batch);
+        batch.flush(window);
         return;
     }
 
@@ -533,7 +584,7 @@ void Player::render(sf::RenderWindow& window) {
 
     // Ajuster l'origine pour que le flip soit correct
     if (!m_facingRight) {
-        m_sprite->setOrigin(sf::Vector2f(m_sprite->getTexture().getSize().x, 0.0f));
+        m_sprite->setOrigin(sf::Vector2f(static_cast<float>(m_sprite->getTextureRect().size.x), 0.0f));
     } else {
         m_sprite->setOrigin(sf::Vector2f(0.0f, 0.0f));
     }
@@ -542,126 +593,49 @@ void Player::render(sf::RenderWindow& window) {
     unsigned char alpha = static_cast<unsigned char>(m_chargeAlpha * 255.0f);
     m_sprite->setColor(sf::Color(255, 255, 255, alpha));
 
-    // Dessiner le sprite
+    // Position affichée: entre le début et la fin du dernier tick (résolue par les collisions).
+    // Les effets attachés au joueur suivent le même décalage que le sprite
+    const sf::Vector2f renderPosition = m_interpolationPosition + (m_position - m_interpolationPosition) * interpolation;
+    sf::Transform renderOffset;
+    renderOffset.translate(renderPosition - m_position);
+
+    m_sprite->setPosition(renderPosition);
     window.draw(*m_sprite);
 
     // Dessiner les lucioles si le double saut est débloqué
     if (m_hasDoubleJump) {
-        // Utiliser la position avec inertie au lieu de la position directe du joueur
-        const float playerCenterX = m_fireflyLagPosition.x;
-        const float playerTopY = m_fireflyLagPosition.y;
-
-        // Animation de vol réaliste (mouvement en forme de 8 allongé)
-        m_fireflyTimer += 0.08f; // Vitesse d'animation
-
-        // Mouvement vertical et horizontal pour un vol naturel
-        float offsetY = std::sin(m_fireflyTimer) * 5.0f;
-        float offsetX = std::cos(m_fireflyTimer * 0.7f) * 3.0f; // Fréquence différente pour effet de lemniscate
+        // Positions et traînées calculées dans update() (une fois par tick)
 
         // Luciole gauche (premier saut disponible)
         if (m_fireflyAlpha1 > 0.0f) {  // Dessiner seulement si au moins un peu visible
-            float firefly1X = playerCenterX - 15.0f + offsetX;
-            float firefly1Y = playerTopY + offsetY;
-
-            // Mettre à jour la position actuelle et ajouter à la traînée
-            m_firefly1Position = sf::Vector2f(firefly1X, firefly1Y);
-            if (m_fireflyAlpha1 > 0.1f) {  // Ajouter des points de traînée seulement si assez visible
-                m_fireflyTrail1.push_back({m_firefly1Position, 0.0f});
-                if (m_fireflyTrail1.size() > MAX_TRAIL_POINTS) {
-                    m_fireflyTrail1.erase(m_fireflyTrail1.begin());
-                }
-            }
-
             // Dessiner la traînée de la luciole 1 (du plus ancien au plus récent)
             for (size_t i = 0; i < m_fireflyTrail1.size(); ++i) {
                 const auto& trailPt = m_fireflyTrail1[i];
                 float alpha = (1.0f - trailPt.age) * 150.0f * m_fireflyAlpha1; // Fade out progressif avec alpha global
                 float size = (1.0f - trailPt.age) * 3.0f + 1.0f; // Taille diminue avec l'âge
 
-                // Halo de la traînée
-                sf::CircleShape trailGlow(size * 2.0f);
-                trailGlow.setPosition(trailPt.position);
-                trailGlow.setFillColor(sf::Color(255, 255, 100, static_cast<unsigned char>(alpha * 0.3f)));
-                trailGlow.setOrigin(sf::Vector2f(size * 2.0f, size * 2.0f));
-                window.draw(trailGlow);
-
-                // Point de la traînée
-                sf::CircleShape trailCircle(size);
-                trailCircle.setPosition(trailPt.position);
-                trailCircle.setFillColor(sf::Color(255, 255, 200, static_cast<unsigned char>(alpha)));
-                trailCircle.setOrigin(sf::Vector2f(size, size));
-                window.draw(trailCircle);
+                // Point de la traînée et son halo
+                batch.addGlow(trailPt.position, size * 2.0f, size, sf::Color(255, 255, 100, static_cast<unsigned char>(alpha)), 0.3f, 0.65f);
             }
 
-            // Luciole principale avec alpha
-            sf::CircleShape firefly1(4.0f);
-            firefly1.setPosition(sf::Vector2f(firefly1X, firefly1Y));
-            firefly1.setFillColor(sf::Color(255, 255, 200, static_cast<unsigned char>(200.0f * m_fireflyAlpha1)));
-            firefly1.setOrigin(sf::Vector2f(4.0f, 4.0f));
-
-            // Lueur autour de la luciole avec alpha
-            sf::CircleShape glow1(8.0f);
-            glow1.setPosition(sf::Vector2f(firefly1X, firefly1Y));
-            glow1.setFillColor(sf::Color(255, 255, 100, static_cast<unsigned char>(80.0f * m_fireflyAlpha1)));
-            glow1.setOrigin(sf::Vector2f(8.0f, 8.0f));
-
-            window.draw(glow1);
-            window.draw(firefly1);
+            // Luciole principale et sa lueur, avec alpha
+            batch.addGlow(m_firefly1Position, 8.0f, 4.0f, sf::Color(255, 255, 100, static_cast<unsigned char>(200.0f * m_fireflyAlpha1)), 0.4f, 0.65f);
         }
 
         // Luciole droite (deuxième saut disponible)
         if (m_fireflyAlpha2 > 0.0f) {  // Dessiner seulement si au moins un peu visible
-            // Mouvement déphasé pour un effet naturel (les deux lucioles ne volent pas de la même façon)
-            float offsetY2 = std::sin(m_fireflyTimer + 1.5f) * 5.0f; // Déphasage de ~90°
-            float offsetX2 = std::cos(m_fireflyTimer * 0.7f + 1.5f) * 3.0f;
-
-            float firefly2X = playerCenterX + 15.0f + offsetX2;
-            float firefly2Y = playerTopY + offsetY2;
-
-            // Mettre à jour la position actuelle et ajouter à la traînée
-            m_firefly2Position = sf::Vector2f(firefly2X, firefly2Y);
-            if (m_fireflyAlpha2 > 0.1f) {  // Ajouter des points de traînée seulement si assez visible
-                m_fireflyTrail2.push_back({m_firefly2Position, 0.0f});
-                if (m_fireflyTrail2.size() > MAX_TRAIL_POINTS) {
-                    m_fireflyTrail2.erase(m_fireflyTrail2.begin());
-                }
-            }
-
             // Dessiner la traînée de la luciole 2 (du plus ancien au plus récent)
             for (size_t i = 0; i < m_fireflyTrail2.size(); ++i) {
                 const auto& trailPt = m_fireflyTrail2[i];
                 float alpha = (1.0f - trailPt.age) * 150.0f * m_fireflyAlpha2; // Fade out progressif avec alpha global
                 float size = (1.0f - trailPt.age) * 3.0f + 1.0f; // Taille diminue avec l'âge
 
-                // Halo de la traînée
-                sf::CircleShape trailGlow(size * 2.0f);
-                trailGlow.setPosition(trailPt.position);
-                trailGlow.setFillColor(sf::Color(255, 255, 100, static_cast<unsigned char>(alpha * 0.3f)));
-                trailGlow.setOrigin(sf::Vector2f(size * 2.0f, size * 2.0f));
-                window.draw(trailGlow);
-
-                // Point de la traînée
-                sf::CircleShape trailCircle(size);
-                trailCircle.setPosition(trailPt.position);
-                trailCircle.setFillColor(sf::Color(255, 255, 200, static_cast<unsigned char>(alpha)));
-                trailCircle.setOrigin(sf::Vector2f(size, size));
-                window.draw(trailCircle);
+                // Point de la traînée et son halo
+                batch.addGlow(trailPt.position, size * 2.0f, size, sf::Color(255, 255, 100, static_cast<unsigned char>(alpha)), 0.3f, 0.65f);
             }
 
-            // Luciole principale avec alpha
-            sf::CircleShape firefly2(4.0f);
-            firefly2.setPosition(sf::Vector2f(firefly2X, firefly2Y));
-            firefly2.setFillColor(sf::Color(255, 255, 200, static_cast<unsigned char>(200.0f * m_fireflyAlpha2)));
-            firefly2.setOrigin(sf::Vector2f(4.0f, 4.0f));
-
-            // Lueur autour de la luciole avec alpha
-            sf::CircleShape glow2(8.0f);
-            glow2.setPosition(sf::Vector2f(firefly2X, firefly2Y));
-            glow2.setFillColor(sf::Color(255, 255, 100, static_cast<unsigned char>(80.0f * m_fireflyAlpha2)));
-            glow2.setOrigin(sf::Vector2f(8.0f, 8.0f));
-
-            window.draw(glow2);
-            window.draw(firefly2);
+            // Luciole principale et sa lueur, avec alpha
+            batch.addGlow(m_firefly2Position, 8.0f, 4.0f, sf::Color(255, 255, 100, static_cast<unsigned char>(200.0f * m_fireflyAlpha2)), 0.4f, 0.65f);
         }
     }
 
@@ -677,13 +651,9 @@ void Player::render(sf::RenderWindow& window) {
 
             // Aura grandissante
             float auraSize = 30.0f + prepareProgress * 50.0f;
-            sf::CircleShape prepareAura(auraSize);
-            prepareAura.setPosition(playerCenter);
-            prepareAura.setOrigin(sf::Vector2f(auraSize, auraSize));
-            prepareAura.setFillColor(sf::Color(255, 200, 100, static_cast<unsigned char>(40 + prepareProgress * 60)));
-            prepareAura.setOutlineColor(sf::Color(255, 150, 50, static_cast<unsigned char>(100 + prepareProgress * 100)));
-            prepareAura.setOutlineThickness(2.0f + prepareProgress * 2.0f);
-            window.draw(prepareAura);
+            batch.addCircle(playerCenter, auraSize, sf::Color(255, 200, 100, static_cast<unsigned char>(40 + prepareProgress * 60)));
+            batch.addRing(playerCenter, auraSize, 2.0f + prepareProgress * 2.0f,
+                          sf::Color(255, 150, 50, static_cast<unsigned char>(100 + prepareProgress * 100)));
 
             // Particules qui tournent de plus en plus vite et se rapprochent
             int particleCount = 12;
@@ -696,50 +666,22 @@ void Player::render(sf::RenderWindow& window) {
                 float animTime = (CHARGE_PREPARE_DURATION - m_prepareTimer) * baseSpeed;
                 float angle = baseAngle + animTime;
 
-                float particleX = playerCenter.x + std::cos(angle) * orbitRadius;
-                float particleY = playerCenter.y + std::sin(angle) * orbitRadius;
+                sf::Vector2f particlePosition(playerCenter.x + std::cos(angle) * orbitRadius,
+                                              playerCenter.y + std::sin(angle) * orbitRadius);
 
-                // Particule principale
+                // Particule principale et son halo
                 float particleSize = 4.0f + prepareProgress * 4.0f;
-                sf::CircleShape particle(particleSize);
-                particle.setPosition(sf::Vector2f(particleX, particleY));
-                particle.setOrigin(sf::Vector2f(particleSize, particleSize));
-                particle.setFillColor(sf::Color(255, 220, 100, 220));
-                window.draw(particle);
-
-                // Halo autour de chaque particule
-                sf::CircleShape particleGlow(particleSize * 2.0f);
-                particleGlow.setPosition(sf::Vector2f(particleX, particleY));
-                particleGlow.setOrigin(sf::Vector2f(particleSize * 2.0f, particleSize * 2.0f));
-                particleGlow.setFillColor(sf::Color(255, 180, 50, 80));
-                window.draw(particleGlow);
+                batch.addGlow(particlePosition, particleSize * 2.0f, particleSize, sf::Color(255, 180, 50, 220), 0.36f, 0.3f);
             }
 
             // Éclair central qui pulse
             float pulseIntensity = std::sin((CHARGE_PREPARE_DURATION - m_prepareTimer) * 20.0f) * 0.5f + 0.5f;
-            sf::CircleShape centralGlow(15.0f + pulseIntensity * 10.0f);
-            centralGlow.setPosition(playerCenter);
-            centralGlow.setOrigin(sf::Vector2f(15.0f + pulseIntensity * 10.0f, 15.0f + pulseIntensity * 10.0f));
-            centralGlow.setFillColor(sf::Color(255, 255, 200, static_cast<unsigned char>(150 + pulseIntensity * 100)));
-            window.draw(centralGlow);
+            batch.addCircle(playerCenter, 15.0f + pulseIntensity * 10.0f,
+                            sf::Color(255, 255, 200, static_cast<unsigned char>(150 + pulseIntensity * 100)));
         }
 
         // Dessiner les particules d'explosion
-        for (const auto& p : m_explosionParticles) {
-            // Halo
-            sf::CircleShape glow(p.size * 1.5f);
-            glow.setPosition(p.position);
-            glow.setOrigin(sf::Vector2f(p.size * 1.5f, p.size * 1.5f));
-            glow.setFillColor(sf::Color(p.color.r, p.color.g, p.color.b, static_cast<unsigned char>(p.life * 100)));
-            window.draw(glow);
-
-            // Particule principale
-            sf::CircleShape particle(p.size);
-            particle.setPosition(p.position);
-            particle.setOrigin(sf::Vector2f(p.size, p.size));
-            particle.setFillColor(sf::Color(p.color.r, p.color.g, p.color.b, static_cast<unsigned char>(p.life * 255)));
-            window.draw(particle);
-        }
+        m_explosionParticles.render(batch);
 
         // Dessiner la traînée de la charge (effet spectaculaire)
         if (m_isCharging || !m_chargeTrailPositions.empty()) {
@@ -754,50 +696,34 @@ void Player::render(sf::RenderWindow& window) {
                 unsigned char g = static_cast<unsigned char>(80 + progress * 175);
                 unsigned char b = static_cast<unsigned char>(200 - progress * 180);
 
-                // Halo extérieur (effet de flou)
-                sf::CircleShape outerGlow(size * 1.8f);
-                outerGlow.setPosition(m_chargeTrailPositions[i]);
-                outerGlow.setOrigin(sf::Vector2f(size * 1.8f, size * 1.8f));
-                outerGlow.setFillColor(sf::Color(r, g, b, static_cast<unsigned char>(alpha * 0.25f)));
-                window.draw(outerGlow);
-
-                // Coeur de la traînée
-                sf::CircleShape trailCore(size * 0.6f);
-                trailCore.setPosition(m_chargeTrailPositions[i]);
-                trailCore.setOrigin(sf::Vector2f(size * 0.6f, size * 0.6f));
-                trailCore.setFillColor(sf::Color(255, 255, 220, static_cast<unsigned char>(alpha * 0.9f)));
-                window.draw(trailCore);
+                // Coeur presque blanc (255, 255, 220) et halo extérieur coloré (effet de flou)
+                batch.addGlow(m_chargeTrailPositions[i], size * 1.8f, size * 0.6f,
+                              sf::Color(r, g, b, static_cast<unsigned char>(alpha * 0.9f)), 0.28f, 0.9f);
             }
 
             // Effet d'aura autour du joueur pendant la charge
             if (m_isCharging) {
                 // Cercle d'énergie pulsant
                 float pulseSize = 55.0f + std::sin(m_chargeTimer * 40.0f) * 15.0f;
-                sf::CircleShape energyAura(pulseSize);
-                energyAura.setPosition(playerCenter);
-                energyAura.setOrigin(sf::Vector2f(pulseSize, pulseSize));
-                energyAura.setFillColor(sf::Color(255, 200, 100, 50));
-                energyAura.setOutlineColor(sf::Color(255, 180, 50, 180));
-                energyAura.setOutlineThickness(4.0f);
-                window.draw(energyAura);
+                batch.addCircle(playerCenter, pulseSize, sf::Color(255, 200, 100, 50));
+                batch.addRing(playerCenter, pulseSize, 4.0f, sf::Color(255, 180, 50, 180));
 
                 // Particules d'énergie qui suivent le joueur
                 for (int i = 0; i < 10; ++i) {
                     float angle = (m_chargeTimer * 25.0f) + (i * 0.628f);  // 2π/10
                     float radius = 45.0f + std::sin(angle * 3.0f) * 10.0f;
-                    float particleX = playerCenter.x + std::cos(angle) * radius;
-                    float particleY = playerCenter.y + std::sin(angle) * radius;
-
-                    sf::CircleShape energyParticle(4.0f);
-                    energyParticle.setPosition(sf::Vector2f(particleX, particleY));
-                    energyParticle.setOrigin(sf::Vector2f(4.0f, 4.0f));
-                    energyParticle.setFillColor(sf::Color(255, 230, 120, 230));
-                    window.draw(energyParticle);
+                    sf::Vector2f particlePosition(playerCenter.x + std::cos(angle) * radius,
+                                                  playerCenter.y + std::sin(angle) * radius);
+
+                    batch.addCircle(particlePosition, 4.0f, sf::Color(255, 230, 120, 230));
                 }
 
                 // Lignes de vitesse (effet de motion blur) - s'adaptent à la direction de la charge
                 // Direction opposée à la charge pour l'effet de traînée
                 sf::Vector2f lineDir(-m_chargeDirection.x, -m_chargeDirection.y);
+                // Axes de la ligne orientée dans le sens de la charge (longueur, épaisseur)
+                sf::Vector2f alongAxis = m_chargeDirection;
+                sf::Vector2f acrossAxis(-m_chargeDirection.y, m_chargeDirection.x);
 
                 for (int i = 0; i < 7; ++i) {
                     float distance = 20.0f + i * 25.0f;
@@ -812,27 +738,27 @@ void Player::render(sf::RenderWindow& window) {
                     float lineLength = 50.0f - i * 5.0f;
                     float lineAlpha = 180.0f - i * 22.0f;
 
-                    sf::RectangleShape speedLine(sf::Vector2f(lineLength, 3.0f));
-                    speedLine.setPosition(sf::Vector2f(lineX, lineY));
-
-                    // Rotation de la ligne pour qu'elle suive la direction de la charge
-                    float angle = std::atan2(m_chargeDirection.y, m_chargeDirection.x) * 180.0f / 3.14159f;
-                    speedLine.setRotation(sf::degrees(angle));
-
-                    speedLine.setFillColor(sf::Color(255, 220, 100, static_cast<unsigned char>(lineAlpha)));
-                    window.draw(speedLine);
+                    // Rectangle tourné pour suivre la direction de la charge
+                    sf::Vector2f lineStart(lineX, lineY);
+                    sf::Vector2f lineEnd = lineStart + alongAxis * lineLength;
+                    sf::Vector2f thickness = acrossAxis * 3.0f;
+                    batch.addQuad(lineStart, lineEnd, lineEnd + thickness, lineStart + thickness,
+                                  sf::Color(255, 220, 100, static_cast<unsigned char>(lineAlpha)));
                 }
             }
         }
     }
 
+    // Lucioles, charge et explosion: un seul draw call
+    batch.flush(window, renderOffset);
+
     // Dessiner le contour rouge pour debug (hitbox du joueur)
     // Pour activer: mettre SHOW_DEBUG_HITBOX à true dans Player.hpp
     if constexpr (SHOW_DEBUG_HITBOX) {
         const float playerWidth = 102.0f;
         const float playerHeight = 102.0f;
         sf::RectangleShape debugRect(sf::Vector2f(playerWidth, playerHeight));
-        debugRect.setPosition(m_position);
+        debugRect.setPosition(renderPosition);
         debugRect.setFillColor(sf::Color::Transparent);
         debugRect.setOutlineColor(sf::Color::Red);
         debugRect.setOutlineThickness(2.0f);
@@ -877,7 +803,7 @@ void Player::triggerDisintegration() {
     sf::Vector2f centerPosition = m_position + sf::Vector2f(playerWidth / 2.0f, playerHeight / 2.0f);
 
     // Créer l'effet de désintégration avec une couleur bleue (couleur du wizard)
-    m_particleSystem.createDisintegrationEffect(centerPosition, sf::Color(100, 150, 255));
+    m_particleSystem.burst(centerPosition, ParticleEffects::DISINTEGRATION_COUNT, sf::Color(100, 150, 255));
 
     std::cout << "Player disintegration triggered!" << std::endl;
 }
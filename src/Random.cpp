@@ -0,0 +1,27 @@
+#include "Random.hpp"
+#include <iostream>
+#include <random>
+
+Random& Random::getInstance() {
+    static Random instance;
+    return instance;
+}
+
+Random::Random()
+    : m_seed(0)
+{
+    // Seule source d'entropie du jeu, lue une fois
+    std::random_device rd;
+    setSeed((static_cast<std::uint64_t>(rd()) << 32) | rd());
+}
+
+void Random::setSeed(std::uint64_t seed) {
+    m_seed = seed;
+
+    // Même graine pour tous les flux, séquence PCG propre à chacun
+    for (std::size_t i = 0; i < m_streams.size(); ++i) {
+        m_streams[i].reseed(seed, i);
+    }
+
+    std::cout << "Random seed: " << seed << std::endl;
+}
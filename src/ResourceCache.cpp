@@ -0,0 +1,64 @@
+#include "ResourceCache.hpp"
+#include <iostream>
+
+ResourceCache& ResourceCache::getInstance() {
+    static ResourceCache instance;
+    return instance;
+}
+
+std::shared_ptr<sf::Texture> ResourceCache::getTexture(const std::string& path) {
+    if (auto texture = find<sf::Texture>(path)) {
+        return texture;
+    }
+
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->loadFromFile(path)) {
+        return nullptr;
+    }
+    store(path, texture);
+    return texture;
+}
+
+std::shared_ptr<sf::Font> ResourceCache::getFont(const std::string& path) {
+    if (auto font = find<sf::Font>(path)) {
+        return font;
+    }
+
+    auto font = std::make_shared<sf::Font>();
+    if (!font->openFromFile(path)) {
+        return nullptr;
+    }
+    store(path, font);
+    return font;
+}
+
+std::shared_ptr<sf::SoundBuffer> ResourceCache::getSoundBuffer(const std::string& path) {
+    if (auto buffer = find<sf::SoundBuffer>(path)) {
+        return buffer;
+    }
+
+    auto buffer = std::make_shared<sf::SoundBuffer>();
+    if (!buffer->loadFromFile(path)) {
+        return nullptr;
+    }
+    store(path, buffer);
+    return buffer;
+}
+
+std::size_t ResourceCache::evictUnused() {
+    std::size_t evicted = 0;
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->second.resource.use_count() == 1) {
+            it = m_entries.erase(it);
+            ++evicted;
+        } else {
+            ++it;
+        }
+    }
+
+    if (evicted > 0) {
+        std::cout << "ResourceCache: " << evicted << " ressource(s) libérée(s), "
+                  << m_entries.size() << " en cache" << std::endl;
+    }
+    return evicted;
+}
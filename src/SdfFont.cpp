@@ -0,0 +1,345 @@
+#include "SdfFont.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+    // Le canal alpha de l'atlas contient la distance au contour: 0.5 = bord du glyphe
+    const char* SDF_FRAGMENT_SHADER = R"(
+        uniform sampler2D atlas;
+        uniform vec4 outlineColor;
+        uniform float outlineWidth;  // Épaisseur du contour (unités de distance)
+        uniform float smoothing;     // Demi-largeur de l'anticrénelage (unités de distance)
+
+        void main() {
+            float distance = texture2D(atlas, gl_TexCoord[0].xy).a;
+            float fill = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+            float edge = 0.5 - outlineWidth;
+            float coverage = smoothstep(edge - smoothing, edge + smoothing, distance);
+            vec4 color = mix(outlineColor, gl_Color, fill);
+            gl_FragColor = vec4(color.rgb, color.a * coverage);
+        }
+    )";
+
+    const float FAR = 1e20f;
+
+    // Transformée de distance euclidienne 1D (Felzenszwalb & Huttenlocher): d[q] = min_p (q - p)² + f[p]
+    void distance1d(const std::vector<float>& f, std::vector<float>& d, std::vector<int>& v, std::vector<float>& z, int n) {
+        int k = 0;
+        v[0] = 0;
+        z[0] = -FAR;
+        z[1] = FAR;
+        for (int q = 1; q < n; ++q) {
+            float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * q - 2.0f * v[k]);
+            while (s <= z[k]) {
+                --k;
+                s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2.0f * q - 2.0f * v[k]);
+            }
+            ++k;
+            v[k] = q;
+            z[k] = s;
+            z[k + 1] = FAR;
+        }
+
+        k = 0;
+        for (int q = 0; q < n; ++q) {
+            while (z[k + 1] < q) ++k;
+            d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+        }
+    }
+
+    // Distance (texels) de chaque pixel au pixel cible le plus proche (0 sur les cibles)
+    std::vector<float> distanceTransform(const std::vector<bool>& target, int width, int height) {
+        const int n = std::max(width, height);
+        std::vector<float> grid(static_cast<std::size_t>(width) * height);
+        std::vector<float> f(n), d(n), z(n + 1);
+        std::vector<int> v(n);
+
+        for (std::size_t i = 0; i < grid.size(); ++i) {
+            grid[i] = target[i] ? 0.0f : FAR;
+        }
+
+        // Colonnes puis lignes (la transformée 2D est séparable)
+        for (int x = 0; x < width; ++x) {
+            for (int y = 0; y < height; ++y) f[y] = grid[y * width + x];
+            distance1d(f, d, v, z, height);
+            for (int y = 0; y < height; ++y) grid[y * width + x] = d[y];
+        }
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) f[x] = grid[y * width + x];
+            distance1d(f, d, v, z, width);
+            for (int x = 0; x < width; ++x) grid[y * width + x] = std::sqrt(d[x]);
+        }
+        return grid;
+    }
+}
+
+SdfFont::SdfFont()
+    : m_ready(false)
+{
+}
+
+bool SdfFont::build(const sf::Font& font, bool bold) {
+    m_ready = false;
+
+    // Rastérisation à la taille de base (une seule fois), puis copie de la page de glyphes
+    for (int i = 0; i < CHAR_COUNT; ++i) {
+        font.getGlyph(static_cast<char32_t>(FIRST_CHAR + i), BASE_SIZE, bold);
+    }
+    const sf::Image page = font.getTexture(BASE_SIZE).copyToImage();
+
+    m_kerning.assign(static_cast<std::size_t>(CHAR_COUNT) * CHAR_COUNT, 0.0f);
+    for (int a = 0; a < CHAR_COUNT; ++a) {
+        for (int b = 0; b < CHAR_COUNT; ++b) {
+            m_kerning[a * CHAR_COUNT + b] = font.getKerning(FIRST_CHAR + a, FIRST_CHAR + b, BASE_SIZE, bold);
+        }
+    }
+
+    // Placement en étagères dans un atlas de largeur fixe
+    const unsigned int atlasWidth = 1024;
+    std::vector<sf::Vector2i> positions(CHAR_COUNT);
+    sf::Vector2i cursor(0, 0);
+    int shelfHeight = 0;
+    for (int i = 0; i < CHAR_COUNT; ++i) {
+        const sf::Glyph& glyph = font.getGlyph(static_cast<char32_t>(FIRST_CHAR + i), BASE_SIZE, bold);
+        Glyph& sdfGlyph = m_glyphs[i];
+        sdfGlyph.advance = glyph.advance;
+        sdfGlyph.visible = glyph.textureRect.size.x > 0 && glyph.textureRect.size.y > 0;
+        if (!sdfGlyph.visible) continue;
+
+        sf::Vector2i size = glyph.textureRect.size + sf::Vector2i(2 * SPREAD, 2 * SPREAD);
+        if (cursor.x + size.x > static_cast<int>(atlasWidth)) {
+            cursor = sf::Vector2i(0, cursor.y + shelfHeight);
+            shelfHeight = 0;
+        }
+        positions[i] = cursor;
+        cursor.x += size.x;
+        shelfHeight = std::max(shelfHeight, size.y);
+
+        sdfGlyph.textureRect = sf::IntRect(positions[i], size);
+        sdfGlyph.bounds = sf::FloatRect(glyph.bounds.position - sf::Vector2f(SPREAD, SPREAD),
+                                        sf::Vector2f(size));
+    }
+    const unsigned int atlasHeight = static_cast<unsigned int>(cursor.y + shelfHeight);
+
+    // Champ de distance signé de chaque glyphe, encodé dans l'alpha (0.5 = contour)
+    sf::Image atlasImage(sf::Vector2u(atlasWidth, std::max(atlasHeight, 1u)), sf::Color(255, 255, 255, 0));
+    for (int i = 0; i < CHAR_COUNT; ++i) {
+        const Glyph& sdfGlyph = m_glyphs[i];
+        if (!sdfGlyph.visible) continue;
+
+        const sf::IntRect source = font.getGlyph(static_cast<char32_t>(FIRST_CHAR + i), BASE_SIZE, bold).textureRect;
+        const int width = sdfGlyph.textureRect.size.x;
+        const int height = sdfGlyph.textureRect.size.y;
+
+        std::vector<bool> inside(static_cast<std::size_t>(width) * height, false);
+        std::vector<bool> outside(inside.size(), true);
+        for (int y = 0; y < source.size.y; ++y) {
+            for (int x = 0; x < source.size.x; ++x) {
+                sf::Vector2u pixel(static_cast<unsigned int>(source.position.x + x), static_cast<unsigned int>(source.position.y + y));
+                bool isInside = page.getPixel(pixel).a >= 128;
+                std::size_t index = static_cast<std::size_t>(y + SPREAD) * width + (x + SPREAD);
+                inside[index] = isInside;
+                outside[index] = !isInside;
+            }
+        }
+
+        std::vector<float> toInside = distanceTransform(inside, width, height);
+        std::vector<float> toOutside = distanceTransform(outside, width, height);
+
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                std::size_t index = static_cast<std::size_t>(y) * width + x;
+                // Le contour passe entre deux texels: demi-texel de correction
+                float distance = inside[index] ? toOutside[index] - 0.5f : -(toInside[index] - 0.5f);
+                float value = std::clamp(0.5f + distance / (2.0f * SPREAD), 0.0f, 1.0f);
+                atlasImage.setPixel(sf::Vector2u(sdfGlyph.textureRect.position + sf::Vector2i(x, y)),
+                                    sf::Color(255, 255, 255, static_cast<std::uint8_t>(value * 255.0f)));
+            }
+        }
+    }
+
+    if (!m_atlas.loadFromImage(atlasImage)) {
+        std::cerr << "✗ Failed to upload SDF font atlas" << std::endl;
+        return false;
+    }
+    m_atlas.setSmooth(true);  // Interpolation bilinéaire des distances
+
+    if (sf::Shader::isAvailable()) {
+        m_shader = std::make_unique<sf::Shader>();
+        if (!m_shader->loadFromMemory(SDF_FRAGMENT_SHADER, sf::Shader::Type::Fragment)) {
+            std::cerr << "✗ Failed to compile SDF text shader" << std::endl;
+            m_shader.reset();
+        }
+    }
+
+    // Sans shader: seuil dur au contour (alpha test) précalculé dans une seconde texture
+    if (!m_shader) {
+        sf::Image alphaTestImage = atlasImage;
+        for (unsigned int y = 0; y < alphaTestImage.getSize().y; ++y) {
+            for (unsigned int x = 0; x < alphaTestImage.getSize().x; ++x) {
+                bool inside = alphaTestImage.getPixel(sf::Vector2u(x, y)).a >= 128;
+                alphaTestImage.setPixel(sf::Vector2u(x, y), sf::Color(255, 255, 255, inside ? 255 : 0));
+            }
+        }
+        if (!m_alphaTestAtlas.loadFromImage(alphaTestImage)) {
+            std::cerr << "✗ Failed to upload SDF alpha-test atlas" << std::endl;
+            return false;
+        }
+        m_alphaTestAtlas.setSmooth(true);
+    }
+
+    std::cout << "SDF font atlas: " << atlasWidth << "x" << atlasHeight << " ("
+              << CHAR_COUNT << " glyphes, taille de base " << BASE_SIZE << ")" << std::endl;
+    m_ready = true;
+    return true;
+}
+
+const SdfFont::Glyph& SdfFont::getGlyph(char c) const {
+    if (c < FIRST_CHAR || c > LAST_CHAR) c = '?';
+    return m_glyphs[c - FIRST_CHAR];
+}
+
+float SdfFont::getKerning(char first, char second) const {
+    if (first < FIRST_CHAR || first > LAST_CHAR || second < FIRST_CHAR || second > LAST_CHAR) return 0.0f;
+    return m_kerning[(first - FIRST_CHAR) * CHAR_COUNT + (second - FIRST_CHAR)];
+}
+
+const sf::Shader* SdfFont::prepareShader(unsigned int characterSize, const sf::Color& outlineColor, float outlineThickness) const {
+    if (!m_shader) return nullptr;
+
+    // Un pixel à l'écran vaut 1 / (échelle * 2 * SPREAD) en unités de distance
+    float scale = static_cast<float>(characterSize) / BASE_SIZE;
+    float pixel = 1.0f / (scale * 2.0f * SPREAD);
+
+    m_shader->setUniform("atlas", sf::Shader::CurrentTexture);
+    m_shader->setUniform("outlineColor", sf::Glsl::Vec4(outlineColor));
+    m_shader->setUniform("outlineWidth", std::min(outlineThickness * pixel, 0.45f));
+    m_shader->setUniform("smoothing", 0.7f * pixel);
+    return m_shader.get();
+}
+
+SdfText::SdfText(const SdfFont& font, const std::string& string, unsigned int characterSize)
+    : m_font(&font)
+    , m_string(string)
+    , m_characterSize(characterSize)
+    , m_fillColor(sf::Color::White)
+    , m_outlineColor(sf::Color::Black)
+    , m_outlineThickness(0.0f)
+    , m_vertices(sf::PrimitiveType::Triangles)
+{
+    rebuild();
+}
+
+void SdfText::setString(const std::string& string) {
+    if (string == m_string) return;
+    m_string = string;
+    rebuild();
+}
+
+void SdfText::setCharacterSize(unsigned int characterSize) {
+    if (characterSize == m_characterSize) return;
+    m_characterSize = characterSize;
+    rebuild();
+}
+
+void SdfText::setFillColor(const sf::Color& color) {
+    m_fillColor = color;
+    for (std::size_t i = 0; i < m_vertices.getVertexCount(); ++i) {
+        m_vertices[i].color = color;
+    }
+}
+
+void SdfText::rebuild() {
+    m_vertices.clear();
+    m_bounds = sf::FloatRect();
+    if (!m_font->isReady()) return;
+
+    const float scale = static_cast<float>(m_characterSize) / SdfFont::BASE_SIZE;
+    const float spread = static_cast<float>(SdfFont::SPREAD);
+
+    float penX = 0.0f;
+    float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+    bool first = true;
+    char previous = 0;
+
+    for (char c : m_string) {
+        penX += m_font->getKerning(previous, c) * scale;
+        previous = c;
+
+        const SdfFont::Glyph& glyph = m_font->getGlyph(c);
+        if (glyph.visible) {
+            // Quad de la glyphe, marge de distance comprise (position 0 = ligne de base)
+            sf::Vector2f topLeft(penX + glyph.bounds.position.x * scale, glyph.bounds.position.y * scale);
+            sf::Vector2f bottomRight = topLeft + glyph.bounds.size * scale;
+            sf::Vector2f texTopLeft(glyph.textureRect.position);
+            sf::Vector2f texBottomRight = texTopLeft + sf::Vector2f(glyph.textureRect.size);
+
+            const sf::Vertex corners[4] = {
+                {topLeft, m_fillColor, texTopLeft},
+                {{bottomRight.x, topLeft.y}, m_fillColor, {texBottomRight.x, texTopLeft.y}},
+                {{topLeft.x, bottomRight.y}, m_fillColor, {texTopLeft.x, texBottomRight.y}},
+                {bottomRight, m_fillColor, texBottomRight}
+            };
+            m_vertices.append(corners[0]);
+            m_vertices.append(corners[1]);
+            m_vertices.append(corners[2]);
+            m_vertices.append(corners[2]);
+            m_vertices.append(corners[1]);
+            m_vertices.append(corners[3]);
+
+            // Limites de la glyphe elle-même (sans la marge de distance)
+            sf::Vector2f glyphMin = topLeft + sf::Vector2f(spread, spread) * scale;
+            sf::Vector2f glyphMax = bottomRight - sf::Vector2f(spread, spread) * scale;
+            if (first) {
+                minX = glyphMin.x; minY = glyphMin.y; maxX = glyphMax.x; maxY = glyphMax.y;
+                first = false;
+            } else {
+                minX = std::min(minX, glyphMin.x);
+                minY = std::min(minY, glyphMin.y);
+                maxX = std::max(maxX, glyphMax.x);
+                maxY = std::max(maxY, glyphMax.y);
+            }
+        }
+
+        penX += glyph.advance * scale;
+    }
+
+    m_bounds = sf::FloatRect(sf::Vector2f(minX, minY), sf::Vector2f(maxX - minX, maxY - minY));
+}
+
+sf::FloatRect SdfText::getLocalBounds() const {
+    return sf::FloatRect(m_bounds.position - sf::Vector2f(m_outlineThickness, m_outlineThickness),
+                         m_bounds.size + sf::Vector2f(2.0f * m_outlineThickness, 2.0f * m_outlineThickness));
+}
+
+void SdfText::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (m_vertices.getVertexCount() == 0) return;
+
+    states.transform *= getTransform();
+    states.shader = m_font->prepareShader(m_characterSize, m_outlineColor, m_outlineThickness);
+    if (states.shader) {
+        states.texture = &m_font->getTexture();
+        target.draw(m_vertices, states);
+        return;
+    }
+
+    // Sans shader: glyphes seuillés; contour approché par 8 copies décalées à la couleur du contour
+    states.texture = &m_font->getAlphaTestTexture();
+    if (m_outlineThickness > 0.0f) {
+        sf::VertexArray outline = m_vertices;
+        for (std::size_t i = 0; i < outline.getVertexCount(); ++i) {
+            outline[i].color = m_outlineColor;
+        }
+
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                if (dx == 0 && dy == 0) continue;
+                sf::RenderStates offsetStates = states;
+                offsetStates.transform.translate(sf::Vector2f(dx * m_outlineThickness, dy * m_outlineThickness));
+                target.draw(outline, offsetStates);
+            }
+        }
+    }
+    target.draw(m_vertices, states);
+}
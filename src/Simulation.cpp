@@ -0,0 +1,109 @@
+#include "Simulation.hpp"
+#include <chrono>
+#include <iostream>
+
+const sf::Time Simulation::TimeStep = sf::seconds(1.f / 60.f);
+
+Simulation::Simulation(CharacterType characterType)
+    : m_level(std::make_unique<Level>(true))
+    , m_player(std::make_unique<Player>(characterType, true))
+    , m_respawnPosition(0.0f, 0.0f)
+    , m_falls(0)
+    , m_finished(false)
+{
+    // Propriétés des tiles (collisions) sans charger le tileset
+    m_level->getTilemap().loadFromFile("assets/tiles/Mossy Tileset/Mossy - TileSet.png");
+}
+
+bool Simulation::loadLevel(int levelNumber) {
+    std::string levelPath = (levelNumber == 0) ? "levels/prologue.json" :
+                            "levels/level_" + std::to_string(levelNumber) + ".json";
+
+    if (!m_level->loadFromFile(levelPath)) {
+        std::cerr << "Simulation: impossible de charger " << levelPath << std::endl;
+        return false;
+    }
+    m_level->generateEnemies(levelNumber);
+
+    // Mêmes règles de pouvoirs que Game::loadLevel
+    m_player->resetHealth();
+    m_player->resetDisintegration();
+    if (levelNumber >= 4) {
+        m_player->unlockDoubleJump();
+    } else {
+        m_player->lockDoubleJump();
+    }
+    if (levelNumber >= 8) {
+        m_player->unlockHeroCharge();
+    } else {
+        m_player->lockHeroCharge();
+    }
+
+    // Centrer le joueur sur le portail d'entrée (portail = 64x64, joueur = 102x102)
+    if (m_level->hasEntrancePortal()) {
+        sf::Vector2f portalPos = m_level->getEntrancePortalPosition();
+        m_respawnPosition = sf::Vector2f(portalPos.x + 32.0f - 51.0f, portalPos.y + 32.0f - 51.0f);
+    }
+    respawn();
+
+    m_falls = 0;
+    m_finished = false;
+    return true;
+}
+
+void Simulation::setKey(sf::Keyboard::Key key, bool isPressed) {
+    m_player->handleInput(key, isPressed);
+}
+
+void Simulation::respawn() {
+    m_player->setPosition(m_respawnPosition);
+    m_player->setVelocity(sf::Vector2f(0.0f, 0.0f));
+}
+
+bool Simulation::step() {
+    if (isOver()) {
+        return false;
+    }
+
+    m_player->update(TimeStep);
+    m_level->update(TimeStep, *m_player);
+
+    // Chute hors du niveau: même pénalité que dans Game::update, réapparition immédiate
+    // (pas d'animation de désintégration à attendre sans rendu)
+    const float levelHeight = static_cast<float>(m_level->getHeight() * m_level->getTileSize());
+    if (m_player->getPosition().y > levelHeight + 200.0f) {
+        m_player->takeDamage(20);
+        m_falls++;
+        if (!m_player->isDead()) {
+            respawn();
+        }
+    }
+
+    if (m_level->isPlayerAtFinish(*m_player)) {
+        m_finished = true;
+    }
+
+    return !isOver();
+}
+
+Simulation::Result Simulation::run(int tickCount) {
+    Result result;
+
+    auto start = std::chrono::steady_clock::now();
+    // Chaque pas exécuté compte, y compris celui qui termine la partie (sortie ou mort);
+    // une simulation déjà terminée n'avance plus
+    while (result.ticks < tickCount && !isOver()) {
+        step();
+        result.ticks++;
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    result.elapsedSeconds = std::chrono::duration<double>(end - start).count();
+    result.ticksPerSecond = result.elapsedSeconds > 0.0 ? result.ticks / result.elapsedSeconds : 0.0;
+    result.finalPosition = m_player->getPosition();
+    result.health = m_player->getHealth();
+    result.falls = m_falls;
+    result.finished = m_finished;
+    result.dead = m_player->isDead();
+    return result;
+}
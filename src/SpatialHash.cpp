@@ -0,0 +1,102 @@
+#include "SpatialHash.hpp"
+#include <algorithm>
+#include <cmath>
+
+SpatialHash::SpatialHash(float cellSize)
+    : m_cellSize(cellSize)
+    , m_origin(0.0f, 0.0f)
+    , m_columns(1)
+    , m_rows(1)
+    , m_cells(1)
+    , m_queryCounter(0)
+{
+}
+
+void SpatialHash::reset(const sf::FloatRect& worldBounds) {
+    m_origin = worldBounds.position;
+    m_columns = std::max(1, static_cast<int>(std::ceil(worldBounds.size.x / m_cellSize)));
+    m_rows = std::max(1, static_cast<int>(std::ceil(worldBounds.size.y / m_cellSize)));
+
+    // Conserver la capacité des cellules d'une reconstruction à l'autre
+    m_cells.resize(static_cast<std::size_t>(m_columns) * m_rows);
+    for (auto& cell : m_cells) {
+        cell.clear();
+    }
+}
+
+SpatialHash::CellRange SpatialHash::getCellRange(const sf::FloatRect& bounds) const {
+    auto column = [this](float x) {
+        return std::clamp(static_cast<int>(std::floor((x - m_origin.x) / m_cellSize)), 0, m_columns - 1);
+    };
+    auto row = [this](float y) {
+        return std::clamp(static_cast<int>(std::floor((y - m_origin.y) / m_cellSize)), 0, m_rows - 1);
+    };
+
+    return {column(bounds.position.x), row(bounds.position.y),
+            column(bounds.position.x + bounds.size.x), row(bounds.position.y + bounds.size.y)};
+}
+
+void SpatialHash::insert(int id, const sf::FloatRect& bounds) {
+    if (static_cast<std::size_t>(id) >= m_queryStamps.size()) {
+        m_queryStamps.resize(id + 1, 0);
+    }
+
+    CellRange range = getCellRange(bounds);
+    for (int y = range.top; y <= range.bottom; ++y) {
+        for (int x = range.left; x <= range.right; ++x) {
+            cellAt(x, y).push_back(id);
+        }
+    }
+}
+
+void SpatialHash::remove(int id, const sf::FloatRect& bounds) {
+    CellRange range = getCellRange(bounds);
+    for (int y = range.top; y <= range.bottom; ++y) {
+        for (int x = range.left; x <= range.right; ++x) {
+            std::vector<int>& cell = cellAt(x, y);
+            auto it = std::find(cell.begin(), cell.end(), id);
+            if (it != cell.end()) {
+                // L'ordre dans une cellule n'a pas d'importance
+                *it = cell.back();
+                cell.pop_back();
+            }
+        }
+    }
+}
+
+void SpatialHash::update(int id, const sf::FloatRect& oldBounds, const sf::FloatRect& newBounds) {
+    CellRange oldRange = getCellRange(oldBounds);
+    CellRange newRange = getCellRange(newBounds);
+    if (oldRange.left == newRange.left && oldRange.top == newRange.top &&
+        oldRange.right == newRange.right && oldRange.bottom == newRange.bottom) {
+        return;
+    }
+
+    remove(id, oldBounds);
+    insert(id, newBounds);
+}
+
+void SpatialHash::query(const sf::FloatRect& area, std::vector<int>& results) {
+    results.clear();
+
+    if (++m_queryCounter == 0) {
+        // Le compteur a fait le tour: repartir de tampons vierges
+        std::fill(m_queryStamps.begin(), m_queryStamps.end(), 0);
+        m_queryCounter = 1;
+    }
+
+    CellRange range = getCellRange(area);
+    for (int y = range.top; y <= range.bottom; ++y) {
+        for (int x = range.left; x <= range.right; ++x) {
+            for (int id : cellAt(x, y)) {
+                if (m_queryStamps[id] != m_queryCounter) {
+                    m_queryStamps[id] = m_queryCounter;
+                    results.push_back(id);
+                }
+            }
+        }
+    }
+
+    // Ordre de parcours stable (ordre d'ajout des éléments), indépendant des cellules
+    std::sort(results.begin(), results.end());
+}
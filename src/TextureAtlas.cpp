@@ -0,0 +1,146 @@
+#include "TextureAtlas.hpp"
+#include "CookedAssets.hpp"
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+TextureAtlas::TextureAtlas()
+    : m_smooth(false)
+    , m_mipmaps(false)
+{
+}
+
+int TextureAtlas::addImage(const sf::Image& image, const sf::IntRect& area) {
+    sf::IntRect source = area;
+    if (source.size.x <= 0 || source.size.y <= 0) {
+        source = sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(image.getSize()));
+    }
+
+    // Copier uniquement la zone demandée
+    sf::Image frameImage(sf::Vector2u(source.size), sf::Color::Transparent);
+    if (!frameImage.copy(image, sf::Vector2u(0, 0), source)) {
+        std::cerr << "TextureAtlas: invalid frame area" << std::endl;
+        return -1;
+    }
+
+    int frameIndex = static_cast<int>(m_frames.size());
+    m_frames.push_back(Frame());
+    m_pending.push_back({frameIndex, std::move(frameImage)});
+    return frameIndex;
+}
+
+int TextureAtlas::addFile(const std::string& filepath) {
+    CookedAssets::Entry cooked = CookedAssets::getInstance().resolve(filepath);
+
+    sf::Image image;
+    if (!image.loadFromFile(cooked.path)) {
+        return -1;
+    }
+    return addDecoded(image, cooked);
+}
+
+int TextureAtlas::addDecoded(const sf::Image& image, const CookedAssets::Entry& source) {
+    int frameIndex = addImage(image);
+    if (frameIndex >= 0) {
+        m_frames[frameIndex].scale = source.scale;
+        m_mipmaps = m_mipmaps || source.mipmaps;
+    }
+    return frameIndex;
+}
+
+bool TextureAtlas::build() {
+    if (m_pending.empty()) return true;
+
+    const unsigned int pageLimit = std::min(MAX_PAGE_SIZE, sf::Texture::getMaximumSize());
+
+    // Trier par hauteur décroissante: les étagères se remplissent mieux
+    std::vector<std::size_t> order(m_pending.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+        return m_pending[a].image.getSize().y > m_pending[b].image.getSize().y;
+    });
+
+    // Placement en étagères: chaque frame reçoit une page et une position
+    struct Placement {
+        std::size_t pending;
+        sf::Vector2u position;
+    };
+    std::vector<std::vector<Placement>> pages(1);
+    std::vector<sf::Vector2u> pageSizes(1, sf::Vector2u(0, 0));
+    unsigned int shelfX = 0;
+    unsigned int shelfY = 0;
+    unsigned int shelfHeight = 0;
+
+    for (std::size_t index : order) {
+        sf::Vector2u size = m_pending[index].image.getSize();
+        if (size.x + PADDING > pageLimit || size.y + PADDING > pageLimit) {
+            std::cerr << "TextureAtlas: frame too large (" << size.x << "x" << size.y << ")" << std::endl;
+            return false;
+        }
+
+        // Nouvelle étagère si la ligne est pleine
+        if (shelfX + size.x + PADDING > pageLimit) {
+            shelfX = 0;
+            shelfY += shelfHeight;
+            shelfHeight = 0;
+        }
+
+        // Nouvelle page si la page est pleine
+        if (shelfY + size.y + PADDING > pageLimit) {
+            pages.emplace_back();
+            pageSizes.emplace_back(0, 0);
+            shelfX = 0;
+            shelfY = 0;
+            shelfHeight = 0;
+        }
+
+        pages.back().push_back({index, sf::Vector2u(shelfX, shelfY)});
+        sf::Vector2u& pageSize = pageSizes.back();
+        pageSize.x = std::max(pageSize.x, shelfX + size.x + PADDING);
+        pageSize.y = std::max(pageSize.y, shelfY + size.y + PADDING);
+
+        shelfX += size.x + PADDING;
+        shelfHeight = std::max(shelfHeight, size.y + PADDING);
+    }
+
+    // Composer chaque page sur le CPU puis l'envoyer en une seule fois au GPU
+    for (std::size_t p = 0; p < pages.size(); ++p) {
+        sf::Image pageImage(pageSizes[p], sf::Color::Transparent);
+
+        for (const Placement& placement : pages[p]) {
+            const PendingFrame& pending = m_pending[placement.pending];
+            if (!pageImage.copy(pending.image, placement.position)) {
+                std::cerr << "TextureAtlas: failed to copy frame " << pending.frameIndex << std::endl;
+                return false;
+            }
+
+            Frame& frame = m_frames[pending.frameIndex];
+            frame.page = m_pages.size();
+            frame.rect = sf::IntRect(sf::Vector2i(placement.position), sf::Vector2i(pending.image.getSize()));
+        }
+
+        auto texture = std::make_unique<sf::Texture>();
+        if (!texture->loadFromImage(pageImage)) {
+            std::cerr << "TextureAtlas: failed to upload page " << m_pages.size() << std::endl;
+            return false;
+        }
+        // Les mipmaps ne sont utilisées par OpenGL qu'avec le lissage activé
+        bool hasMipmaps = m_mipmaps && texture->generateMipmap();
+        texture->setSmooth(m_smooth || hasMipmaps);
+
+        std::cout << "  Atlas page " << m_pages.size() << ": " << pageSizes[p].x << "x" << pageSizes[p].y
+                  << " (" << pages[p].size() << " frames)" << std::endl;
+        m_pages.push_back(std::move(texture));
+    }
+
+    m_pending.clear();
+    m_mipmaps = false;
+    return true;
+}
+
+void TextureAtlas::setSmooth(bool smooth) {
+    m_smooth = smooth;
+    for (auto& page : m_pages) {
+        page->setSmooth(smooth);
+    }
+}
@@ -0,0 +1,162 @@
+#include "TileCollision.hpp"
+#include "Tilemap.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Tolérance pour une face exactement au contact du corps
+    constexpr float CONTACT_EPSILON = 0.01f;
+
+    int tileIndex(float coordinate, float tileSize) {
+        return static_cast<int>(std::floor(coordinate / tileSize));
+    }
+
+    bool overlapsX(const sf::FloatRect& bounds, float left, float right) {
+        return bounds.position.x < right && bounds.position.x + bounds.size.x > left;
+    }
+
+    // Axe X: la colonne centrale du corps, de la tête jusqu'au-dessus de la ligne
+    // des pieds (celle du sol), contre les faces latérales des tiles solides.
+    void sweepX(const Tilemap& tilemap, const CollisionBody& body, float dx, SweepResult& result) {
+        if (dx == 0.0f) return;
+
+        const float tileSize = static_cast<float>(tilemap.getTileSize());
+        const float centerX = result.position.x + body.size.x / 2.0f;
+        const float targetX = centerX + dx;
+        const int firstRow = tileIndex(result.position.y, tileSize);
+        const int lastRow = tileIndex(result.position.y + body.size.y - body.feetOffset, tileSize) - 1;
+        const int step = dx > 0.0f ? 1 : -1;
+        const int lastColumn = tileIndex(targetX, tileSize);
+
+        for (int x = tileIndex(centerX, tileSize); ; x += step) {
+            float nearest = targetX;
+            bool hit = false;
+
+            for (int y = firstRow; y <= lastRow; ++y) {
+                if (!tilemap.isSolid(x, y)) continue;
+
+                sf::FloatRect bounds = tilemap.getTileCollisionBounds(x, y);
+                float face = dx > 0.0f ? bounds.position.x : bounds.position.x + bounds.size.x;
+                // Face derrière le centre (corps déjà dans la tile) ou au-delà de la cible: ignorée
+                bool reached = dx > 0.0f ? (face >= centerX - CONTACT_EPSILON && face <= nearest)
+                                         : (face <= centerX + CONTACT_EPSILON && face >= nearest);
+                if (reached) {
+                    nearest = face;
+                    hit = true;
+                }
+            }
+
+            // Les faces d'une colonne sont toutes plus proches que celles de la suivante
+            if (hit) {
+                result.position.x += nearest - centerX;
+                result.timeOfImpactX = std::clamp((nearest - centerX) / dx, 0.0f, 1.0f);
+                result.hitWall = true;
+                return;
+            }
+            if (x == lastColumn) break;
+        }
+
+        result.position.x += dx;
+    }
+
+    // Axe Y en descendant: les pieds contre la surface des sols sous toute la largeur du corps
+    void sweepDown(const Tilemap& tilemap, const CollisionBody& body, float dy, SweepResult& result) {
+        const float tileSize = static_cast<float>(tilemap.getTileSize());
+        const float left = result.position.x;
+        const float right = left + body.size.x;
+        const float feetY = result.position.y + body.size.y - body.feetOffset;
+        const float targetFeet = feetY + dy;
+        const int feetRow = tileIndex(feetY, tileSize);
+        const int firstColumn = tileIndex(left, tileSize);
+        const int lastColumn = tileIndex(right, tileSize);
+        const int lastRow = tileIndex(targetFeet + TileCollision::GROUND_SNAP, tileSize);
+
+        for (int y = tileIndex(feetY - TileCollision::GROUND_SNAP, tileSize); y <= lastRow; ++y) {
+            float nearest = targetFeet + TileCollision::GROUND_SNAP;
+            bool hit = false;
+
+            for (int x = firstColumn; x <= lastColumn; ++x) {
+                if (!(tilemap.getCellFlags(x, y) & Tilemap::CELL_GROUND)) continue;
+
+                sf::FloatRect bounds = tilemap.getTileCollisionBounds(x, y);
+                if (!overlapsX(bounds, left, right)) continue;
+
+                // Surface de marche: sous l'herbe, et jamais au-dessus de la collision box
+                float grassDepth = tileSize * (tilemap.getGrassDepth(x, y) / 100.0f);
+                float surface = std::max(bounds.position.y, y * tileSize + grassDepth);
+
+                // Un sol au-dessus des pieds n'est retenu que dans la ligne des pieds
+                // (pieds enfoncés dans l'herbe: le corps est remonté à la surface)
+                if (surface < feetY - TileCollision::GROUND_SNAP && y != feetRow) continue;
+                if (surface <= nearest) {
+                    nearest = surface;
+                    hit = true;
+                }
+            }
+
+            if (hit) {
+                result.position.y += nearest - feetY;
+                result.timeOfImpactY = dy > 0.0f ? std::clamp((nearest - feetY) / dy, 0.0f, 1.0f) : 0.0f;
+                result.grounded = true;
+                return;
+            }
+        }
+
+        result.position.y += dy;
+    }
+
+    // Axe Y en montant: le haut du corps contre le dessous des plafonds
+    void sweepUp(const Tilemap& tilemap, const CollisionBody& body, float dy, SweepResult& result) {
+        const float tileSize = static_cast<float>(tilemap.getTileSize());
+        const float left = result.position.x;
+        const float right = left + body.size.x;
+        const float top = result.position.y;
+        const float targetTop = top + dy;
+        const int firstColumn = tileIndex(left, tileSize);
+        const int lastColumn = tileIndex(right, tileSize);
+        const int lastRow = tileIndex(targetTop, tileSize);
+
+        for (int y = tileIndex(top, tileSize); y >= lastRow; --y) {
+            float nearest = targetTop;
+            bool hit = false;
+
+            for (int x = firstColumn; x <= lastColumn; ++x) {
+                if (!(tilemap.getCellFlags(x, y) & Tilemap::CELL_CEILING)) continue;
+
+                sf::FloatRect bounds = tilemap.getTileCollisionBounds(x, y);
+                if (!overlapsX(bounds, left, right)) continue;
+
+                float bottom = bounds.position.y + bounds.size.y;
+                if (bottom <= top + CONTACT_EPSILON && bottom >= nearest) {
+                    nearest = bottom;
+                    hit = true;
+                }
+            }
+
+            if (hit) {
+                result.position.y = nearest;
+                result.timeOfImpactY = std::clamp((nearest - top) / dy, 0.0f, 1.0f);
+                result.hitCeiling = true;
+                return;
+            }
+        }
+
+        result.position.y += dy;
+    }
+}
+
+SweepResult TileCollision::move(const Tilemap& tilemap, const CollisionBody& body,
+                                const sf::Vector2f& start, const sf::Vector2f& displacement) {
+    SweepResult result;
+    result.position = start;
+
+    // X d'abord, puis Y depuis la position horizontale atteinte (glissement le long des murs)
+    sweepX(tilemap, body, displacement.x, result);
+    if (displacement.y < 0.0f) {
+        sweepUp(tilemap, body, displacement.y, result);
+    } else {
+        sweepDown(tilemap, body, displacement.y, result);
+    }
+
+    return result;
+}
@@ -1,8 +1,11 @@
 #include "TileProperties.hpp"
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 
+const TileCollisionData TilePropertiesManager::s_noCollision;
+
 TilePropertiesManager& TilePropertiesManager::getInstance() {
     static TilePropertiesManager instance;
     return instance;
@@ -51,6 +54,9 @@ bool TilePropertiesManager::loadFromFile(const std::string& filepath) {
     // Remove whitespace and newlines for easier parsing
     content.erase(std::remove_if(content.begin(), content.end(), ::isspace), content.end());
 
+    // Enregistrements lus, répartis dans les tables dense à la fin
+    std::vector<std::pair<int, TileProperties>> parsed;
+
     // Skip opening brace
     size_t pos = content.find('{');
     if (pos == std::string::npos) return false;
@@ -202,65 +208,42 @@ bool TilePropertiesManager::loadFromFile(const std::string& filepath) {
         }
 
         // Store the properties
-        m_properties[tileId] = props;
+        parsed.emplace_back(tileId, props);
 
         // Skip closing brace and comma
         while (pos < content.length() && (content[pos] == '}' || content[pos] == ',' || std::isspace(content[pos]))) pos++;
     }
 
-    std::cout << "Loaded " << m_properties.size() << " tile properties from " << filepath << std::endl;
-    return true;
-}
-
-const TileProperties* TilePropertiesManager::getTileProperties(int tileId) const {
-    auto it = m_properties.find(tileId);
-    if (it != m_properties.end()) {
-        return &it->second;
+    // Tables denses: partie chaude (collisions) et partie froide (textes) séparées
+    int maxTileId = -1;
+    for (const auto& entry : parsed) {
+        maxTileId = std::max(maxTileId, entry.first);
+    }
+    m_collisionData.assign(maxTileId + 1, TileCollisionData());
+    m_tileInfo.assign(maxTileId + 1, TileInfo());
+
+    for (const auto& [tileId, props] : parsed) {
+        if (tileId < 0) continue;
+
+        TileCollisionData& data = m_collisionData[tileId];
+        data.collisionType = props.collisionType;
+        data.solid = props.collisionType != CollisionType::NONE && props.collisionType != CollisionType::EMPTY;
+        data.defined = true;
+        data.grassDepth = props.grassDepth;
+        data.collisionBox = props.collisionBox;
+        data.damage = props.damage;
+
+        TileInfo& info = m_tileInfo[tileId];
+        info.description = props.description;
+        info.portalDestination = props.portalDestination;
+        info.notes = props.notes;
     }
-    return nullptr;
-}
-
-bool TilePropertiesManager::isSolid(int tileId) const {
-    const TileProperties* props = getTileProperties(tileId);
-    if (!props) return false;
-
-    // All collision types except NONE and EMPTY are considered solid in some way
-    return props->collisionType != CollisionType::NONE &&
-           props->collisionType != CollisionType::EMPTY;
-}
-
-bool TilePropertiesManager::isPlatform(int tileId) const {
-    const TileProperties* props = getTileProperties(tileId);
-    if (!props) return false;
-
-    return props->collisionType == CollisionType::PLATFORM;
-}
-
-bool TilePropertiesManager::isSlope(int tileId) const {
-    const TileProperties* props = getTileProperties(tileId);
-    if (!props) return false;
-
-    return props->collisionType == CollisionType::SLOPE_LEFT ||
-           props->collisionType == CollisionType::SLOPE_RIGHT;
-}
-
-CollisionType TilePropertiesManager::getCollisionType(int tileId) const {
-    const TileProperties* props = getTileProperties(tileId);
-    if (!props) return CollisionType::NONE;
-
-    return props->collisionType;
-}
-
-float TilePropertiesManager::getGrassDepth(int tileId) const {
-    const TileProperties* props = getTileProperties(tileId);
-    if (!props) return 0.0f;
 
-    return props->grassDepth;
+    std::cout << "Loaded " << parsed.size() << " tile properties from " << filepath << std::endl;
+    return true;
 }
 
-CollisionBox TilePropertiesManager::getCollisionBox(int tileId) const {
-    const TileProperties* props = getTileProperties(tileId);
-    if (!props) return CollisionBox();
-
-    return props->collisionBox;
+const TileInfo* TilePropertiesManager::getTileInfo(int tileId) const {
+    if (!getCollisionData(tileId).defined) return nullptr;
+    return &m_tileInfo[tileId];
 }
@@ -1,156 +1,454 @@
 #include "Tilemap.hpp"
+#include "CookedAssets.hpp"
+#include "ResourceCache.hpp"
 #include <iostream>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Le quad couvre la zone visible; ses texCoords contiennent les coordonnées monde (pixels)
+    const char* TILE_FRAGMENT_SHADER = R"(
+        uniform sampler2D tileset;
+        uniform sampler2D indexMap;
+        uniform vec2 mapSize;       // Taille de la carte en tiles
+        uniform vec2 tilesetSize;   // Taille du tileset en pixels
+        uniform float tileSize;     // Taille d'une tile à l'écran
+        uniform float sectionSize;  // Taille d'une section dans le tileset
+        uniform float tilesPerRow;
+
+        void main() {
+            vec2 world = gl_TexCoord[0].xy;
+            vec2 cell = floor(world / tileSize);
+            if (cell.x < 0.0 || cell.y < 0.0 || cell.x >= mapSize.x || cell.y >= mapSize.y)
+                discard;
+
+            vec4 index = texture2D(indexMap, (cell + 0.5) / mapSize);
+            float id = floor(index.r * 255.0 + 0.5) + floor(index.g * 255.0 + 0.5) * 256.0 - 1.0;
+            if (id < 0.0)
+                discard;
+
+            vec2 section = vec2(mod(id, tilesPerRow), floor(id / tilesPerRow));
+            vec2 local = (world - cell * tileSize) / tileSize;
+            gl_FragColor = texture2D(tileset, (section + local) * sectionSize / tilesetSize) * gl_Color;
+        }
+    )";
+
+    // Encode un id de tile dans un texel (0 = pas de tile)
+    void encodeTileIndex(int tileId, std::uint8_t* texel) {
+        int value = tileId + 1;
+        texel[0] = static_cast<std::uint8_t>(value & 0xFF);
+        texel[1] = static_cast<std::uint8_t>((value >> 8) & 0xFF);
+        texel[2] = 0;
+        texel[3] = 255;
+    }
+}
 
 Tilemap::Tilemap(int tileSize)
     : m_tileSize(tileSize)
     , m_width(0)
     , m_height(0)
     , m_tilesetWidthInTiles(0)
-    , m_vertices(sf::PrimitiveType::Triangles)  // Utiliser Triangles
+    , m_sectionSize(TILESET_SECTION_SIZE)
+    , m_headless(false)
+    , m_deferredUpload(false)
+    , m_chunksX(0)
+    , m_chunksY(0)
+    , m_nonEmptyChunks(0)
+    , m_drawnChunks(0)
+    , m_culledChunks(0)
+    , m_renderMode(RenderMode::Chunks)
+    , m_shaderLoaded(false)
+    , m_indexTextureReady(false)
 {
 }
 
 bool Tilemap::loadFromFile(const std::string& tilesetPath) {
-    m_tileset = std::make_shared<sf::Texture>();
-    if (!m_tileset->loadFromFile(tilesetPath)) {
-        std::cerr << "Failed to load tileset: " << tilesetPath << std::endl;
+    // Sans rendu: seules les propriétés des tiles (collisions) sont nécessaires
+    if (m_headless) {
+        TilePropertiesManager::getInstance().loadFromFile("assets/tiles/mossy_tileset_config.json");
+        bakeCollision();
+        return true;
+    }
+
+    // Utiliser le tileset cuit (réduit à la taille d'affichage) s'il existe
+    CookedAssets::Entry cooked = CookedAssets::getInstance().resolve(tilesetPath);
+
+    std::shared_ptr<sf::Texture> tileset = ResourceCache::getInstance().getTexture(cooked.path);
+    if (!tileset) {
+        std::cerr << "Failed to load tileset: " << cooked.path << std::endl;
         return false;
     }
+    setTileset(std::move(tileset), cooked);
+    return true;
+}
 
-    // Désactiver le lissage pour un rendu pixel-perfect
-    m_tileset->setSmooth(false);
+void Tilemap::setTileset(std::shared_ptr<sf::Texture> tileset, const CookedAssets::Entry& cooked) {
+    m_tileset = std::move(tileset);
+    m_sectionSize = static_cast<int>(std::lround(TILESET_SECTION_SIZE * cooked.scale));
+
+    // Désactiver le lissage pour un rendu pixel-perfect (sauf si le tileset cuit a des mipmaps)
+    m_tileset->setSmooth(cooked.mipmaps && m_tileset->generateMipmap());
     // S'assurer que la texture est répétée
     m_tileset->setRepeated(false);
 
-    std::cout << "Tileset loaded: " << tilesetPath << " ("
+    std::cout << "Tileset loaded: " << cooked.path << " ("
               << m_tileset->getSize().x << "x" << m_tileset->getSize().y << ")" << std::endl;
 
-    // Load tile properties configuration
+    // Load tile properties configuration (et mettre à jour les collisions d'une carte déjà chargée)
     TilePropertiesManager::getInstance().loadFromFile("assets/tiles/mossy_tileset_config.json");
+    bakeCollision();
+}
 
-    return true;
+void Tilemap::shareTileset(const Tilemap& other) {
+    m_tileset = other.m_tileset;
+    m_sectionSize = other.m_sectionSize;
 }
 
 void Tilemap::loadFromData(const std::vector<std::vector<int>>& data, int tilesetWidth) {
-    m_tiles = data;
-    m_height = data.size();
-    m_width = data.empty() ? 0 : data[0].size();
+    const int height = static_cast<int>(data.size());
+    const int width = data.empty() ? 0 : static_cast<int>(data[0].size());
+
+    std::vector<std::int16_t> tiles(static_cast<size_t>(width) * height, -1);
+    for (int y = 0; y < height; ++y) {
+        int count = std::min(width, static_cast<int>(data[y].size()));
+        for (int x = 0; x < count; ++x) {
+            tiles[static_cast<size_t>(y) * width + x] = static_cast<std::int16_t>(data[y][x]);
+        }
+    }
+    loadFromData(tiles, width, height, tilesetWidth);
+}
+
+void Tilemap::loadFromData(const std::vector<std::int16_t>& tiles, int width, int height, int tilesetWidth) {
+    m_tiles = tiles;
+    m_width = width;
+    m_height = height;
     m_tilesetWidthInTiles = tilesetWidth;
 
     std::cout << "Loading tilemap data: " << m_width << "x" << m_height << std::endl;
     std::cout << "Tileset width in tiles: " << m_tilesetWidthInTiles << std::endl;
-    updateVertices();
-    std::cout << "Generated " << m_vertices.getVertexCount() << " vertices" << std::endl;
+
+    bakeCollision();
+
+    if (m_headless) return;
+
+    // La texture d'indices est une ressource GPU: en préparation différée, toujours des chunks
+    if (!m_deferredUpload && m_renderMode == RenderMode::Shader && updateIndexTexture()) {
+        m_chunks.clear();
+        m_chunksX = m_chunksY = 0;
+        m_nonEmptyChunks = 0;
+    } else {
+        m_renderMode = RenderMode::Chunks;
+        updateVertices();
+    }
 }
 
-void Tilemap::updateVertices() {
-    m_vertices.clear();
+std::uint8_t Tilemap::describeTile(int tileId, CellSurface& surface) {
+    const TileCollisionData& data = TilePropertiesManager::getInstance().getCollisionData(tileId);
+    surface = CellSurface();
+    if (!data.solid) return 0;
+
+    surface.collisionType = data.collisionType;
+    surface.grassDepth = data.grassDepth;
+    surface.collisionBox = data.collisionBox;
+
+    bool wall = data.collisionType == CollisionType::WALL_LEFT || data.collisionType == CollisionType::WALL_RIGHT;
+    bool ceiling = data.collisionType == CollisionType::CEILING;
+    return CELL_SOLID | (wall ? CELL_WALL : CELL_GROUND) | (ceiling ? CELL_CEILING : 0);
+}
+
+void Tilemap::bakeCollision() {
+    // Propriétés calculées une seule fois par id de tile, puis recopiées dans chaque cellule
+    int maxTileId = -1;
+    for (std::int16_t tileId : m_tiles) {
+        maxTileId = std::max(maxTileId, static_cast<int>(tileId));
+    }
+
+    std::vector<std::uint8_t> flagsById(maxTileId + 1);
+    std::vector<CellSurface> surfaceById(maxTileId + 1);
+    for (int tileId = 0; tileId <= maxTileId; ++tileId) {
+        flagsById[tileId] = describeTile(tileId, surfaceById[tileId]);
+    }
+
+    m_cellFlags.assign(m_tiles.size(), 0);
+    m_cellSurfaces.assign(m_tiles.size(), CellSurface());
+    for (size_t i = 0; i < m_tiles.size(); ++i) {
+        int tileId = m_tiles[i];
+        if (tileId < 0) continue;
+        m_cellFlags[i] = flagsById[tileId];
+        m_cellSurfaces[i] = surfaceById[tileId];
+    }
+}
 
-    int tileCount = 0;
+bool Tilemap::setRenderMode(RenderMode mode) {
+    if (m_headless) return false;
+
+    if (mode == RenderMode::Shader) {
+        if (!sf::Shader::isAvailable()) {
+            std::cerr << "Tilemap: shaders not available, keeping chunk renderer" << std::endl;
+            return false;
+        }
+        if (!m_shaderLoaded) {
+            m_shaderLoaded = m_tileShader.loadFromMemory(TILE_FRAGMENT_SHADER, sf::Shader::Type::Fragment);
+            if (!m_shaderLoaded) {
+                std::cerr << "Tilemap: failed to compile tile shader" << std::endl;
+                return false;
+            }
+        }
+        if (!updateIndexTexture()) {
+            return false;
+        }
+
+        // La géométrie des chunks n'est plus nécessaire
+        m_chunks.clear();
+        m_chunksX = m_chunksY = 0;
+        m_nonEmptyChunks = 0;
+    } else {
+        m_indexTextureReady = false;
+        if (m_renderMode != RenderMode::Chunks) {
+            updateVertices();
+        }
+    }
+
+    m_renderMode = mode;
+    std::cout << "Tilemap render mode: " << (mode == RenderMode::Shader ? "shader" : "chunks") << std::endl;
+    return true;
+}
+
+void Tilemap::setTile(int x, int y, int tileId) {
+    if (x < 0 || x >= m_width || y < 0 || y >= m_height) {
+        return;
+    }
+    const size_t index = cellIndex(x, y);
+    m_tiles[index] = static_cast<std::int16_t>(tileId);
+    m_cellFlags[index] = describeTile(tileId, m_cellSurfaces[index]);
+
+    if (m_renderMode == RenderMode::Shader) {
+        if (m_indexTextureReady) {
+            std::uint8_t texel[4];
+            encodeTileIndex(tileId, texel);
+            m_indexTexture.update(texel, sf::Vector2u(1, 1), sf::Vector2u(x, y));
+        }
+    } else if (!m_chunks.empty()) {
+        Chunk& chunk = m_chunks[(y / CHUNK_SIZE) * m_chunksX + x / CHUNK_SIZE];
+        bool wasEmpty = chunk.vertices.empty();
+        buildChunk(x / CHUNK_SIZE, y / CHUNK_SIZE);
+        m_nonEmptyChunks += static_cast<int>(wasEmpty) - static_cast<int>(chunk.vertices.empty());
+    }
+}
+
+bool Tilemap::updateIndexTexture() {
+    m_indexTextureReady = false;
+    if (m_width <= 0 || m_height <= 0) {
+        return false;
+    }
+
+    unsigned int maxSize = sf::Texture::getMaximumSize();
+    if (static_cast<unsigned int>(m_width) > maxSize || static_cast<unsigned int>(m_height) > maxSize) {
+        std::cerr << "Tilemap: level too large for an index texture (" << m_width << "x" << m_height
+                  << ", max " << maxSize << ")" << std::endl;
+        return false;
+    }
+
+    if (!m_indexTexture.resize(sf::Vector2u(m_width, m_height))) {
+        std::cerr << "Tilemap: failed to create index texture" << std::endl;
+        return false;
+    }
+    m_indexTexture.setSmooth(false);
+
+    std::vector<std::uint8_t> pixels(static_cast<size_t>(m_width) * m_height * 4);
     for (int y = 0; y < m_height; ++y) {
         for (int x = 0; x < m_width; ++x) {
-            int tileNumber = m_tiles[y][x];
+            encodeTileIndex(m_tiles[cellIndex(x, y)], &pixels[(static_cast<size_t>(y) * m_width + x) * 4]);
+        }
+    }
+    m_indexTexture.update(pixels.data());
+
+    m_indexTextureReady = true;
+    return true;
+}
+
+void Tilemap::updateVertices() {
+    m_chunksX = (m_width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    m_chunksY = (m_height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+    m_chunks.clear();
+    m_chunks.resize(m_chunksX * m_chunksY);
+
+    size_t vertexCount = 0;
+    m_nonEmptyChunks = 0;
+    for (int cy = 0; cy < m_chunksY; ++cy) {
+        for (int cx = 0; cx < m_chunksX; ++cx) {
+            buildChunk(cx, cy);
+            const Chunk& chunk = m_chunks[cy * m_chunksX + cx];
+            vertexCount += chunk.vertices.size();
+            if (!chunk.vertices.empty()) {
+                m_nonEmptyChunks++;
+            }
+        }
+    }
+
+    std::cout << "Generated " << vertexCount << " vertices in " << m_chunks.size()
+              << " chunks (" << CHUNK_SIZE << "x" << CHUNK_SIZE << " tiles)" << std::endl;
+}
+
+void Tilemap::buildChunk(int chunkX, int chunkY) {
+    Chunk& chunk = m_chunks[chunkY * m_chunksX + chunkX];
+    chunk.vertices.clear();
+    chunk.hasBuffer = false;
+
+    if (m_tilesetWidthInTiles <= 0) return;
+
+    const int startX = chunkX * CHUNK_SIZE;
+    const int startY = chunkY * CHUNK_SIZE;
+    const int endX = std::min(startX + CHUNK_SIZE, m_width);
+    const int endY = std::min(startY + CHUNK_SIZE, m_height);
+
+    const float size = static_cast<float>(m_tileSize);
+    const float section = static_cast<float>(m_sectionSize);
+
+    for (int y = startY; y < endY; ++y) {
+        for (int x = startX; x < endX; ++x) {
+            int tileNumber = m_tiles[cellIndex(x, y)];
 
             // -1 = pas de tile
             if (tileNumber < 0) continue;
 
-            // Calculer la position dans le tileset
+            // Section du tileset (256x256, ou 64x64 si cuit) affichée à la taille d'une tile (64x64)
             int tu = tileNumber % m_tilesetWidthInTiles;
             int tv = tileNumber / m_tilesetWidthInTiles;
 
-            // Debug pour les premières tiles
-            if (tileCount < 3) {
-                std::cout << "  Tile #" << tileNumber << " at pos(" << x << "," << y << ") -> texture grid(" << tu << "," << tv << ")"
-                          << " -> texture pixels(" << (tu * m_tileSize) << "," << (tv * m_tileSize) << ")" << std::endl;
-            }
-            tileCount++;
-
-            // Positions des 4 coins du quad
-            float px = x * m_tileSize;
-            float py = y * m_tileSize;
-
-            // Coordonnées de texture
-            float tx = tu * m_tileSize;
-            float ty = tv * m_tileSize;
+            float px = x * size;
+            float py = y * size;
+            float tx = tu * section;
+            float ty = tv * section;
 
             // Deux triangles pour former un quad
-            sf::Vertex v0, v1, v2, v3, v4, v5;
-
-            // Triangle 1
-            v0.position = sf::Vector2f(px, py);
-            v0.texCoords = sf::Vector2f(tx, ty);
-            v0.color = sf::Color::White;  // Important: couleur blanche pour afficher la texture correctement
-
-            v1.position = sf::Vector2f(px + m_tileSize, py);
-            v1.texCoords = sf::Vector2f(tx + m_tileSize, ty);
-            v1.color = sf::Color::White;
-
-            v2.position = sf::Vector2f(px, py + m_tileSize);
-            v2.texCoords = sf::Vector2f(tx, ty + m_tileSize);
-            v2.color = sf::Color::White;
-
-            // Triangle 2
-            v3.position = sf::Vector2f(px, py + m_tileSize);
-            v3.texCoords = sf::Vector2f(tx, ty + m_tileSize);
-            v3.color = sf::Color::White;
-
-            v4.position = sf::Vector2f(px + m_tileSize, py);
-            v4.texCoords = sf::Vector2f(tx + m_tileSize, ty);
-            v4.color = sf::Color::White;
-
-            v5.position = sf::Vector2f(px + m_tileSize, py + m_tileSize);
-            v5.texCoords = sf::Vector2f(tx + m_tileSize, ty + m_tileSize);
-            v5.color = sf::Color::White;
-
-            m_vertices.append(v0);
-            m_vertices.append(v1);
-            m_vertices.append(v2);
-            m_vertices.append(v3);
-            m_vertices.append(v4);
-            m_vertices.append(v5);
+            chunk.vertices.push_back({{px, py}, sf::Color::White, {tx, ty}});
+            chunk.vertices.push_back({{px + size, py}, sf::Color::White, {tx + section, ty}});
+            chunk.vertices.push_back({{px, py + size}, sf::Color::White, {tx, ty + section}});
+            chunk.vertices.push_back({{px, py + size}, sf::Color::White, {tx, ty + section}});
+            chunk.vertices.push_back({{px + size, py}, sf::Color::White, {tx + section, ty}});
+            chunk.vertices.push_back({{px + size, py + size}, sf::Color::White, {tx + section, ty + section}});
         }
     }
+
+    // Envoyer la géométrie au GPU une seule fois (elle ne change plus ensuite)
+    if (!m_headless && !m_deferredUpload) {
+        uploadChunk(chunk);
+    }
+}
+
+void Tilemap::uploadChunk(Chunk& chunk) {
+    if (!chunk.vertices.empty() && sf::VertexBuffer::isAvailable()) {
+        chunk.hasBuffer = chunk.buffer.create(chunk.vertices.size()) &&
+                          chunk.buffer.update(chunk.vertices.data());
+    }
+}
+
+void Tilemap::uploadDeferred() {
+    m_deferredUpload = false;
+    if (m_headless) return;
+
+    for (Chunk& chunk : m_chunks) {
+        uploadChunk(chunk);
+    }
 }
 
 void Tilemap::render(sf::RenderWindow& window) {
+    m_drawnChunks = 0;
+    m_culledChunks = 0;
+
     if (!m_tileset) {
         return;
     }
 
-    // Afficher le niveau avec des sections de 256x256 pixels du tileset
-    // mais affichées à une échelle réduite pour correspondre au personnage
-    const int sectionSize = 256;
-    const int sectionsPerRow = 14;
-    const float scale = 0.25f;  // Afficher les tiles à 64x64 pixels au lieu de 256x256
-    const float displaySize = sectionSize * scale;  // 64 pixels
+    // Zone du monde couverte par la vue (boîte englobante, rotation de la caméra incluse)
+    const sf::View& view = window.getView();
+    sf::FloatRect visible = view.getInverseTransform().transformRect(
+        sf::FloatRect(sf::Vector2f(-1.0f, -1.0f), sf::Vector2f(2.0f, 2.0f)));
 
-    for (int y = 0; y < m_height; ++y) {
-        for (int x = 0; x < m_width; ++x) {
-            int tileNumber = m_tiles[y][x];
+    if (m_renderMode == RenderMode::Shader) {
+        renderWithShader(window, visible);
+    } else {
+        renderChunks(window, visible);
+    }
+}
 
-            // -1 = pas de tile
-            if (tileNumber < 0) continue;
+void Tilemap::renderWithShader(sf::RenderWindow& window, const sf::FloatRect& visible) {
+    if (!m_indexTextureReady) {
+        return;
+    }
+
+    // Quad limité à l'intersection de la vue et de la carte
+    float left = std::max(0.0f, visible.position.x);
+    float top = std::max(0.0f, visible.position.y);
+    float right = std::min(static_cast<float>(m_width * m_tileSize), visible.position.x + visible.size.x);
+    float bottom = std::min(static_cast<float>(m_height * m_tileSize), visible.position.y + visible.size.y);
+    if (right <= left || bottom <= top) {
+        return;
+    }
+    m_drawnChunks = 1;  // Un seul quad pour toute la vue
+
+    m_tileShader.setUniform("tileset", *m_tileset);
+    m_tileShader.setUniform("indexMap", m_indexTexture);
+    m_tileShader.setUniform("mapSize", sf::Vector2f(m_width, m_height));
+    m_tileShader.setUniform("tilesetSize", sf::Vector2f(m_tileset->getSize()));
+    m_tileShader.setUniform("tileSize", static_cast<float>(m_tileSize));
+    m_tileShader.setUniform("sectionSize", static_cast<float>(m_sectionSize));
+    m_tileShader.setUniform("tilesPerRow", static_cast<float>(m_tilesetWidthInTiles));
+
+    // texCoords = coordonnées monde, passées telles quelles au shader (pas de texture liée)
+    const sf::Vertex quad[4] = {
+        {{left, top}, sf::Color::White, {left, top}},
+        {{right, top}, sf::Color::White, {right, top}},
+        {{left, bottom}, sf::Color::White, {left, bottom}},
+        {{right, bottom}, sf::Color::White, {right, bottom}}
+    };
+
+    sf::RenderStates states(&m_tileShader);
+    window.draw(quad, 4, sf::PrimitiveType::TriangleStrip, states);
+}
+
+void Tilemap::renderChunks(sf::RenderWindow& window, const sf::FloatRect& visible) {
+    if (m_chunks.empty()) {
+        return;
+    }
 
-            // Calculer quelle section du tileset afficher
-            int sectionX = tileNumber % sectionsPerRow;
-            int sectionY = tileNumber / sectionsPerRow;
-
-            sf::Sprite tileSprite(*m_tileset);
-            tileSprite.setTextureRect(sf::IntRect(
-                sf::Vector2i(sectionX * sectionSize, sectionY * sectionSize),
-                sf::Vector2i(sectionSize, sectionSize)
-            ));
-
-            // Positionner et afficher avec un scale de 0.5 (128x128 à l'écran)
-            tileSprite.setPosition(sf::Vector2f(x * displaySize, y * displaySize));
-            tileSprite.setScale(sf::Vector2f(scale, scale));
-            window.draw(tileSprite);
-
-            // Dessiner un cadre rouge autour de chaque tile pour debug
-            // Pour activer: mettre SHOW_DEBUG_TILE_OUTLINE à true dans Tilemap.hpp
-            if constexpr (SHOW_DEBUG_TILE_OUTLINE) {
-                sf::RectangleShape tileDebugRect(sf::Vector2f(displaySize, displaySize));
-                tileDebugRect.setPosition(sf::Vector2f(x * displaySize, y * displaySize));
+    // Chunks qui intersectent la vue
+    const float chunkPixels = static_cast<float>(CHUNK_SIZE * m_tileSize);
+    int firstX = std::max(0, static_cast<int>(std::floor(visible.position.x / chunkPixels)));
+    int firstY = std::max(0, static_cast<int>(std::floor(visible.position.y / chunkPixels)));
+    int lastX = std::min(m_chunksX - 1, static_cast<int>(std::floor((visible.position.x + visible.size.x) / chunkPixels)));
+    int lastY = std::min(m_chunksY - 1, static_cast<int>(std::floor((visible.position.y + visible.size.y) / chunkPixels)));
+
+    sf::RenderStates states(m_tileset.get());
+
+    for (int cy = firstY; cy <= lastY; ++cy) {
+        for (int cx = firstX; cx <= lastX; ++cx) {
+            const Chunk& chunk = m_chunks[cy * m_chunksX + cx];
+            if (chunk.vertices.empty()) continue;
+            m_drawnChunks++;
+
+            if (chunk.hasBuffer) {
+                window.draw(chunk.buffer, states);
+            } else {
+                window.draw(chunk.vertices.data(), chunk.vertices.size(), sf::PrimitiveType::Triangles, states);
+            }
+        }
+    }
+    m_culledChunks = m_nonEmptyChunks - m_drawnChunks;
+
+    // Dessiner un cadre rouge autour de chaque tile visible pour debug
+    // Pour activer: mettre SHOW_DEBUG_TILE_OUTLINE à true dans Tilemap.hpp
+    if constexpr (SHOW_DEBUG_TILE_OUTLINE) {
+        int endX = std::min(m_width, (lastX + 1) * CHUNK_SIZE);
+        int endY = std::min(m_height, (lastY + 1) * CHUNK_SIZE);
+        for (int y = firstY * CHUNK_SIZE; y < endY; ++y) {
+            for (int x = firstX * CHUNK_SIZE; x < endX; ++x) {
+                if (m_tiles[cellIndex(x, y)] < 0) continue;
+
+                sf::RectangleShape tileDebugRect(sf::Vector2f(m_tileSize, m_tileSize));
+                tileDebugRect.setPosition(sf::Vector2f(x * m_tileSize, y * m_tileSize));
                 tileDebugRect.setFillColor(sf::Color::Transparent);
                 tileDebugRect.setOutlineColor(sf::Color::Red);
                 tileDebugRect.setOutlineThickness(1.0f);
@@ -160,19 +458,6 @@ void Tilemap::render(sf::RenderWindow& window) {
     }
 }
 
-bool Tilemap::isSolid(int x, int y) const {
-    // Hors limites = pas de collision (le joueur tombe dans le vide)
-    if (x < 0 || x >= m_width || y < 0 || y >= m_height) {
-        return false;
-    }
-
-    int tileId = m_tiles[y][x];
-    if (tileId < 0) return false; // -1 = vide
-
-    // Use tile properties manager to check if solid
-    return TilePropertiesManager::getInstance().isSolid(tileId);
-}
-
 sf::FloatRect Tilemap::getTileBounds(int x, int y) const {
     return sf::FloatRect(
         sf::Vector2f(x * m_tileSize, y * m_tileSize),
@@ -181,13 +466,12 @@ sf::FloatRect Tilemap::getTileBounds(int x, int y) const {
 }
 
 sf::FloatRect Tilemap::getTileCollisionBounds(int x, int y) const {
-    int tileId = getTileId(x, y);
-    if (tileId < 0) {
+    if (x < 0 || x >= m_width || y < 0 || y >= m_height) {
         return getTileBounds(x, y);
     }
 
-    // Récupérer la collision box de cette tuile
-    CollisionBox box = TilePropertiesManager::getInstance().getCollisionBox(tileId);
+    // Collision box précalculée de cette cellule (nulle pour une cellule vide)
+    const CollisionBox& box = m_cellSurfaces[cellIndex(x, y)].collisionBox;
 
     // Appliquer les offsets à la bounding box normale
     float left = x * m_tileSize + box.left;
@@ -202,26 +486,19 @@ int Tilemap::getTileId(int x, int y) const {
     if (x < 0 || x >= m_width || y < 0 || y >= m_height) {
         return -1;
     }
-    return m_tiles[y][x];
+    return m_tiles[cellIndex(x, y)];
 }
 
-const TileProperties* Tilemap::getTileProperties(int x, int y) const {
-    int tileId = getTileId(x, y);
-    if (tileId < 0) return nullptr;
-
-    return TilePropertiesManager::getInstance().getTileProperties(tileId);
+const TileInfo* Tilemap::getTileInfo(int x, int y) const {
+    return TilePropertiesManager::getInstance().getTileInfo(getTileId(x, y));
 }
 
 CollisionType Tilemap::getCollisionType(int x, int y) const {
-    int tileId = getTileId(x, y);
-    if (tileId < 0) return CollisionType::NONE;
-
-    return TilePropertiesManager::getInstance().getCollisionType(tileId);
+    if (!isSolid(x, y)) return CollisionType::NONE;
+    return m_cellSurfaces[cellIndex(x, y)].collisionType;
 }
 
 float Tilemap::getGrassDepth(int x, int y) const {
-    int tileId = getTileId(x, y);
-    if (tileId < 0) return 0.0f;
-
-    return TilePropertiesManager::getInstance().getGrassDepth(tileId);
+    if (!isSolid(x, y)) return 0.0f;
+    return m_cellSurfaces[cellIndex(x, y)].grassDepth;
 }
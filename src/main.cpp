@@ -1,9 +1,111 @@
 #include "Game.hpp"
+#include "Random.hpp"
+#include "Simulation.hpp"
+#include <cstdint>
 #include <iostream>
 #include <exception>
+#include <algorithm>
+#include <sstream>
+#include <string>
 
-int main() {
+namespace {
+
+// Mode headless: BoooBee --headless [--ticks N] [--level N] [--character wizard|goat]
+//                                   [--hold-right] [--jump-every N] [--seed N] [--verbose]
+int runHeadless(int argc, char* argv[]) {
+    int ticks = 3600;
+    int levelNumber = 0;
+    int jumpEvery = 0;
+    bool holdRight = false;
+    bool verbose = false;
+    std::uint64_t seed = 1;  // Graine fixe par défaut: deux exécutions identiques donnent le même résultat
+    CharacterType character = CharacterType::Wizard;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--ticks" && hasValue) {
+            ticks = std::stoi(argv[++i]);
+        } else if (arg == "--level" && hasValue) {
+            levelNumber = std::stoi(argv[++i]);
+        } else if (arg == "--character" && hasValue) {
+            character = std::string(argv[++i]) == "goat" ? CharacterType::Goat : CharacterType::Wizard;
+        } else if (arg == "--hold-right") {
+            holdRight = true;
+        } else if (arg == "--jump-every" && hasValue) {
+            jumpEvery = std::stoi(argv[++i]);
+        } else if (arg == "--seed" && hasValue) {
+            seed = std::stoull(argv[++i]);
+        } else if (arg == "--verbose") {
+            verbose = true;
+        }
+    }
+
+    // Les logs de debug du gameplay faussent la mesure du débit: les couper sauf si demandé
+    std::ostringstream discarded;
+    std::streambuf* coutBuffer = std::cout.rdbuf();
+    if (!verbose) {
+        std::cout.rdbuf(discarded.rdbuf());
+    }
+
+    Random::getInstance().setSeed(seed);
+    Simulation simulation(character);
+    bool loaded = simulation.loadLevel(levelNumber);
+
+    Simulation::Result result;
+    if (loaded) {
+        if (holdRight) {
+            simulation.setKey(sf::Keyboard::Key::Right, true);
+        }
+
+        // Simuler par tranches pour pouvoir appuyer sur saut régulièrement
+        int slice = jumpEvery > 0 ? jumpEvery : ticks;
+        while (result.ticks < ticks) {
+            if (jumpEvery > 0) {
+                simulation.setKey(sf::Keyboard::Key::Space, true);
+                simulation.setKey(sf::Keyboard::Key::Space, false);
+            }
+
+            Simulation::Result partial = simulation.run(std::min(slice, ticks - result.ticks));
+            result.ticks += partial.ticks;
+            result.elapsedSeconds += partial.elapsedSeconds;
+            result.finalPosition = partial.finalPosition;
+            result.health = partial.health;
+            result.falls = partial.falls;
+            result.finished = partial.finished;
+            result.dead = partial.dead;
+            if (result.finished || result.dead) break;
+        }
+        result.ticksPerSecond = result.elapsedSeconds > 0.0 ? result.ticks / result.elapsedSeconds : 0.0;
+    }
+
+    std::cout.rdbuf(coutBuffer);
+
+    if (!loaded) {
+        std::cerr << "Headless: niveau " << levelNumber << " introuvable" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Headless simulation: niveau " << levelNumber << " (graine " << seed << "), " << result.ticks << " ticks en "
+              << result.elapsedSeconds * 1000.0 << " ms (" << static_cast<long long>(result.ticksPerSecond) << " ticks/s)" << std::endl;
+    std::cout << "  Position finale: (" << result.finalPosition.x << ", " << result.finalPosition.y << ")"
+              << ", vie: " << result.health << ", chutes: " << result.falls
+              << (result.finished ? ", sortie atteinte" : "") << (result.dead ? ", mort" : "") << std::endl;
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
     try {
+        for (int i = 1; i < argc; ++i) {
+            if (std::string(argv[i]) == "--headless") {
+                return runHeadless(argc, argv);
+            }
+        }
+
         Game game;
         game.run();
     }
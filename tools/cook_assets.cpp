@@ -0,0 +1,206 @@
+// Outil hors ligne: réduit les images à leur taille d'affichage.
+//
+// Usage: asset_cooker <config> <dossier source> <dossier de sortie>
+//
+// Chaque image listée dans la configuration est réduite avec un filtre de
+// moyenne par surface (alpha prémultiplié), écrite sous le même chemin relatif
+// dans le dossier de sortie, et décrite dans manifest.txt pour que le jeu
+// (CookedAssets) sache charger la version cuite et compenser son échelle.
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct CookRule {
+    float scale;
+    bool mipmaps;
+    std::string path;
+};
+
+std::vector<CookRule> loadConfig(const fs::path& configPath) {
+    std::vector<CookRule> rules;
+    std::ifstream file(configPath);
+    if (!file.is_open()) {
+        std::cerr << "Impossible d'ouvrir la configuration: " << configPath << std::endl;
+        return rules;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+
+        std::istringstream stream(line);
+        CookRule rule;
+        int mipmaps = 0;
+        if (!(stream >> rule.scale >> mipmaps)) continue;
+        std::getline(stream >> std::ws, rule.path);
+        if (rule.path.empty() || rule.scale <= 0.0f) continue;
+
+        rule.mipmaps = mipmaps != 0;
+        rules.push_back(rule);
+    }
+    return rules;
+}
+
+// Réduction par moyenne de surface: chaque pixel de sortie moyenne exactement
+// la zone source qu'il recouvre (fonctionne pour des facteurs non entiers)
+void resampleAxis(const std::vector<float>& source, unsigned int sourceLength, unsigned int lines,
+                  unsigned int stride, unsigned int lineStride,
+                  std::vector<float>& target, unsigned int targetLength,
+                  unsigned int targetStride, unsigned int targetLineStride) {
+    const double ratio = static_cast<double>(sourceLength) / targetLength;
+
+    for (unsigned int line = 0; line < lines; ++line) {
+        for (unsigned int t = 0; t < targetLength; ++t) {
+            double start = t * ratio;
+            double end = (t + 1) * ratio;
+            float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+            for (unsigned int s = static_cast<unsigned int>(start); s < sourceLength && s < end; ++s) {
+                float weight = static_cast<float>(std::min<double>(s + 1, end) - std::max<double>(s, start));
+                const float* pixel = &source[(line * lineStride + s * stride) * 4];
+                for (int c = 0; c < 4; ++c) sum[c] += pixel[c] * weight;
+            }
+
+            float* out = &target[(line * targetLineStride + t * targetStride) * 4];
+            for (int c = 0; c < 4; ++c) out[c] = sum[c] / static_cast<float>(ratio);
+        }
+    }
+}
+
+sf::Image downsample(const sf::Image& source, sf::Vector2u targetSize) {
+    const sf::Vector2u sourceSize = source.getSize();
+    const std::uint8_t* pixels = source.getPixelsPtr();
+
+    // Alpha prémultiplié: les pixels transparents ne "salissent" pas les bords
+    std::vector<float> input(static_cast<std::size_t>(sourceSize.x) * sourceSize.y * 4);
+    for (std::size_t i = 0; i < input.size(); i += 4) {
+        float alpha = pixels[i + 3] / 255.0f;
+        input[i + 0] = pixels[i + 0] * alpha;
+        input[i + 1] = pixels[i + 1] * alpha;
+        input[i + 2] = pixels[i + 2] * alpha;
+        input[i + 3] = pixels[i + 3];
+    }
+
+    // Passe horizontale puis verticale
+    std::vector<float> horizontal(static_cast<std::size_t>(targetSize.x) * sourceSize.y * 4);
+    resampleAxis(input, sourceSize.x, sourceSize.y, 1, sourceSize.x, horizontal, targetSize.x, 1, targetSize.x);
+
+    std::vector<float> output(static_cast<std::size_t>(targetSize.x) * targetSize.y * 4);
+    resampleAxis(horizontal, sourceSize.y, targetSize.x, targetSize.x, 1, output, targetSize.y, targetSize.x, 1);
+
+    std::vector<std::uint8_t> result(output.size());
+    for (std::size_t i = 0; i < output.size(); i += 4) {
+        float alpha = output[i + 3];
+        float inverse = alpha > 0.0f ? 255.0f / alpha : 0.0f;
+        for (int c = 0; c < 3; ++c) {
+            result[i + c] = static_cast<std::uint8_t>(std::clamp(output[i + c] * inverse + 0.5f, 0.0f, 255.0f));
+        }
+        result[i + 3] = static_cast<std::uint8_t>(std::clamp(alpha + 0.5f, 0.0f, 255.0f));
+    }
+
+    return sf::Image(targetSize, result.data());
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        std::cerr << "Usage: " << argv[0] << " <config> <dossier source> <dossier de sortie>" << std::endl;
+        return 1;
+    }
+
+    const fs::path configPath = argv[1];
+    const fs::path sourceRoot = argv[2];
+    const fs::path outputRoot = argv[3];
+
+    std::vector<CookRule> rules = loadConfig(configPath);
+    if (rules.empty()) {
+        std::cerr << "Aucune règle de cuisson" << std::endl;
+        return 1;
+    }
+
+    std::ostringstream manifest;
+    manifest << "# Généré par asset_cooker - ne pas modifier\n";
+    manifest << "# <largeur cuite> <hauteur cuite> <largeur source> <hauteur source> <mips> <chemin source>\n";
+
+    std::uintmax_t sourceBytes = 0;
+    std::uintmax_t cookedBytes = 0;
+    int cookedCount = 0;
+    int failedCount = 0;
+
+    for (const CookRule& rule : rules) {
+        // Un dossier est parcouru récursivement
+        std::vector<fs::path> files;
+        fs::path rulePath = sourceRoot / rule.path;
+        if (fs::is_directory(rulePath)) {
+            for (const auto& entry : fs::recursive_directory_iterator(rulePath)) {
+                if (entry.is_regular_file() && entry.path().extension() == ".png") {
+                    files.push_back(entry.path());
+                }
+            }
+            std::sort(files.begin(), files.end());
+        } else if (fs::is_regular_file(rulePath)) {
+            files.push_back(rulePath);
+        } else {
+            std::cerr << "Introuvable: " << rulePath << std::endl;
+            failedCount++;
+            continue;
+        }
+
+        for (const fs::path& file : files) {
+            std::string relative = fs::relative(file, sourceRoot).generic_string();
+
+            sf::Image source;
+            if (!source.loadFromFile(file)) {
+                std::cerr << "Échec du chargement: " << file << std::endl;
+                failedCount++;
+                continue;
+            }
+
+            sf::Vector2u sourceSize = source.getSize();
+            sf::Vector2u targetSize(
+                std::max(1u, static_cast<unsigned int>(std::lround(sourceSize.x * rule.scale))),
+                std::max(1u, static_cast<unsigned int>(std::lround(sourceSize.y * rule.scale))));
+
+            // Ne jamais agrandir
+            sf::Image cooked = (targetSize.x < sourceSize.x && targetSize.y < sourceSize.y)
+                ? downsample(source, targetSize)
+                : source;
+
+            fs::path outputPath = outputRoot / relative;
+            fs::create_directories(outputPath.parent_path());
+            if (!cooked.saveToFile(outputPath)) {
+                std::cerr << "Échec de l'écriture: " << outputPath << std::endl;
+                failedCount++;
+                continue;
+            }
+
+            manifest << cooked.getSize().x << " " << cooked.getSize().y << " "
+                     << sourceSize.x << " " << sourceSize.y << " "
+                     << (rule.mipmaps ? 1 : 0) << " " << relative << "\n";
+
+            sourceBytes += static_cast<std::uintmax_t>(sourceSize.x) * sourceSize.y * 4;
+            cookedBytes += static_cast<std::uintmax_t>(cooked.getSize().x) * cooked.getSize().y * 4;
+            cookedCount++;
+        }
+    }
+
+    std::ofstream manifestFile(outputRoot / "manifest.txt");
+    manifestFile << manifest.str();
+
+    std::cout << cookedCount << " images cuites (" << failedCount << " échecs), "
+              << sourceBytes / (1024 * 1024) << " Mo -> " << cookedBytes / (1024 * 1024) << " Mo de pixels" << std::endl;
+
+    return failedCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,60 @@
+// Conversion des niveaux entre le JSON (édité) et le format binaire (.bblv).
+//
+// Usage: level_converter <entrée> <sortie>    le sens est déduit des extensions
+//        level_converter --all <dossier>      convertit chaque .json du dossier en .bblv
+//
+// Le jeu charge automatiquement la version binaire d'un niveau quand elle
+// existe et n'est pas plus ancienne que le JSON (voir LevelFile::load).
+
+#include "LevelFile.hpp"
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+bool convert(const fs::path& input, const fs::path& output) {
+    LevelData data;
+    bool loaded = input.extension() == LevelFile::BINARY_EXTENSION
+        ? LevelFile::loadBinary(input.string(), data)
+        : LevelFile::loadJson(input.string(), data);
+    if (!loaded) {
+        return false;
+    }
+
+    bool saved = output.extension() == LevelFile::BINARY_EXTENSION
+        ? LevelFile::saveBinary(output.string(), data)
+        : LevelFile::saveJson(output.string(), data);
+    if (!saved) {
+        return false;
+    }
+
+    std::cout << input.generic_string() << " -> " << output.generic_string() << " ("
+              << data.width << "x" << data.height << ", " << fs::file_size(output) << " octets)" << std::endl;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <entrée> <sortie>" << std::endl;
+        std::cerr << "       " << argv[0] << " --all <dossier>" << std::endl;
+        return 1;
+    }
+
+    if (std::string(argv[1]) == "--all") {
+        int failed = 0;
+        for (const auto& entry : fs::directory_iterator(argv[2])) {
+            if (!entry.is_regular_file() || entry.path().extension() != ".json") continue;
+            if (!convert(entry.path(), LevelFile::binaryPathFor(entry.path().string()))) {
+                failed++;
+            }
+        }
+        return failed == 0 ? 0 : 1;
+    }
+
+    return convert(argv[1], argv[2]) ? 0 : 1;
+}